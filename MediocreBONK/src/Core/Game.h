@@ -3,6 +3,7 @@
 #include "StateMachine.h"
 #include "ResourceManager.h"
 #include "../Utils/Logger.h"
+#include "../Utils/FrameArena.h"
 #include <memory>
 
 namespace MediocreBONK::Core
@@ -64,6 +65,9 @@ namespace MediocreBONK::Core
                 sf::Time deltaTime = clock.restart();
                 timeSinceLastUpdate += deltaTime;
 
+                // Scratch memory of the previous frame (queries, temporary lists) released at once
+                Utils::FrameArena::getInstance().reset();
+
                 // FIXED TIMESTEP: Update in fixed increments (16.67ms each)
                 // Multiple updates may run if frame took too long
                 // This ensures physics runs at consistent speed
@@ -3,6 +3,8 @@
 #include "Transform.h"
 #include "Physics.h"
 #include "../../Utils/Math.h"
+#include "../../Utils/FlowField.h"
+#include "../../Utils/SteeringKernels.h"
 #include <SFML/System/Vector2.hpp>
 
 namespace MediocreBONK::ECS::Components
@@ -26,82 +28,147 @@ namespace MediocreBONK::ECS::Components
             , targetPosition(0.f, 0.f)
             , attackRange(50.f)
             , detectionRange(1500.f) // Increased to detect player from spawn distance (~1151px)
+            , preferredRange(350.f)
+            , orbitRadius(250.f)
+            , orbitDirection(1.f)
+            , systemDriven(false)
+            , flowField(nullptr)
+            , steering(Utils::SteeringMode::None)
+            , steeringDirection(0.f, 0.f)
         {}
 
         void update(sf::Time dt) override
         {
-            if (!owner || !target)
+            // AISystem decides when to think (LOD / time slicing, batched per behaviour)
+            if (systemDriven)
                 return;
 
-            auto* transform = owner->getComponent<Transform>();
-            auto* physics = owner->getComponent<Physics>();
-
-            if (!transform || !physics)
-                return;
+            think();
+            act();
+        }
 
-            auto* targetTransform = target->getComponent<Transform>();
-            if (!targetTransform)
+        // Decide how to move, one enemy at a time (same kernels as AISystem's batches)
+        // usePathing = false: straight line, no flow field lookup (far-away enemies)
+        void think(bool usePathing = true)
+        {
+            steering = Utils::SteeringMode::None;
+            auto* transform = owner ? owner->getComponent<Transform>() : nullptr;
+            if (!transform || !updateTargetPosition())
                 return;
 
-            targetPosition = targetTransform->position;
-            float distance = Utils::Math::distance(transform->position, targetPosition);
-
-            // Check if target is in detection range
-            if (distance > detectionRange)
-                return;
+            const sf::Vector2f& position = transform->position;
+            float detectionSq = detectionRange * detectionRange;
+            float dx = 0.f;
+            float dy = 0.f;
 
             switch (behavior)
             {
             case AIBehavior::ChasePlayer:
-                chaseTarget(transform, physics, distance);
+            {
+                sf::Vector2f flow = sampleFlow(position, usePathing);
+                Utils::SteeringKernels::chase(position.x, position.y, targetPosition.x, targetPosition.y,
+                    detectionSq, attackRange * attackRange, flow.x, flow.y, dx, dy, steering);
                 break;
+            }
             case AIBehavior::Flee:
-                fleeFromTarget(transform, physics);
+                Utils::SteeringKernels::flee(position.x, position.y, targetPosition.x, targetPosition.y,
+                    detectionSq, dx, dy, steering);
+                break;
+            case AIBehavior::Ranged:
+                Utils::SteeringKernels::ranged(position.x, position.y, targetPosition.x, targetPosition.y,
+                    detectionSq, preferredRange, orbitDirection, dx, dy, steering);
+                break;
+            case AIBehavior::Circle:
+                Utils::SteeringKernels::circle(position.x, position.y, targetPosition.x, targetPosition.y,
+                    detectionSq, orbitRadius, orbitDirection, dx, dy, steering);
                 break;
             case AIBehavior::Idle:
                 // Do nothing
                 break;
-            // Future behaviors can be added here
-            default:
-                break;
             }
+            steeringDirection = sf::Vector2f(dx, dy);
         }
 
-        void setTarget(Entity* newTarget)
+        // Apply the last decision (every tick, also when think() was skipped)
+        void act()
         {
-            target = newTarget;
+            if (steering == Utils::SteeringMode::None || !owner)
+                return;
+
+            auto* physics = owner->getComponent<Physics>();
+            if (!physics)
+                return;
+
+            if (steering == Utils::SteeringMode::Hold)
+                physics->velocity = sf::Vector2f(0.f, 0.f);
+            else
+                physics->applyForce(steeringDirection * speed);
         }
 
-        AIBehavior behavior;
-        float speed;
-        float attackRange;
-        float detectionRange;
+        // Decision computed elsewhere (AISystem behaviour kernels)
+        void setSteering(Utils::SteeringMode mode, const sf::Vector2f& direction)
+        {
+            steering = mode;
+            steeringDirection = direction;
+        }
 
-    private:
-        void chaseTarget(Transform* transform, Physics* physics, float distance)
+        // Refresh the cached target position, false if there is no target to follow
+        bool updateTargetPosition()
         {
-            // Stop if within attack range
-            if (distance < attackRange)
-            {
-                physics->velocity = sf::Vector2f(0.f, 0.f);
-                return;
-            }
+            if (!target)
+                return false;
 
-            // Calculate direction to target
-            sf::Vector2f direction = Utils::Math::normalize(targetPosition - transform->position);
+            auto* targetTransform = target->getComponent<Transform>();
+            if (!targetTransform)
+                return false;
 
-            // Apply movement force
-            physics->applyForce(direction * speed);
+            targetPosition = targetTransform->position;
+            return true;
         }
 
-        void fleeFromTarget(Transform* transform, Physics* physics)
+        const sf::Vector2f& getTargetPosition() const { return targetPosition; }
+
+        // Last decision was 'no force' (target out of detection range, no target, Idle)
+        bool isIdle() const { return steering == Utils::SteeringMode::None; }
+
+        // Flow field direction at 'position', (0,0) = go straight at the target
+        // (line of sight clear, outside the field's window, no field, or usePathing = false)
+        sf::Vector2f sampleFlow(const sf::Vector2f& position, bool usePathing) const
         {
-            // Move away from target
-            sf::Vector2f direction = Utils::Math::normalize(transform->position - targetPosition);
-            physics->applyForce(direction * speed);
+            sf::Vector2f direction;
+            bool direct = true;
+            if (!usePathing || !flowField || !flowField->steer(position, direction, direct) || direct)
+                return sf::Vector2f(0.f, 0.f);
+            return direction;
         }
 
+        void setTarget(Entity* newTarget)
+        {
+            target = newTarget;
+        }
+
+        // Shared field toward the target (nullptr: straight line, walks into obstacles)
+        void setFlowField(const Utils::FlowField* field)
+        {
+            flowField = field;
+        }
+
+        AIBehavior behavior;
+        float speed;
+        float attackRange;
+        float detectionRange;
+        float preferredRange;   // Ranged: distance kept from the target
+        float orbitRadius;      // Circle: orbit radius around the target
+        float orbitDirection;   // Ranged / Circle: +1 or -1 (strafe / orbit direction)
+
+        // true: update() does nothing, AISystem calls think()/act()
+        bool systemDriven;
+
+    private:
         Entity* target;
         sf::Vector2f targetPosition;
+        const Utils::FlowField* flowField;
+        Utils::SteeringMode steering;
+        sf::Vector2f steeringDirection; // Unit vector (SteeringMode::Move)
     };
 }
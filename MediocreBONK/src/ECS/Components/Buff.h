@@ -81,7 +81,7 @@ namespace MediocreBONK::ECS::Components
                                 buff.onExpire();
 
                             // Emit BuffExpired event
-                            auto eventData = std::make_unique<Managers::BuffAppliedData>();
+                            auto eventData = Managers::makeEvent<Managers::BuffAppliedData>();
                             eventData->buffName = buff.name;
                             eventData->duration = 0.f;
                             Managers::EventManager::getInstance().queueEvent(
@@ -113,7 +113,7 @@ namespace MediocreBONK::ECS::Components
                 buff.onApply();
 
             // Emit BuffApplied event
-            auto eventData = std::make_unique<Managers::BuffAppliedData>();
+            auto eventData = Managers::makeEvent<Managers::BuffAppliedData>();
             eventData->buffName = buff.name;
             eventData->duration = buff.duration;
             Managers::EventManager::getInstance().queueEvent(
@@ -13,14 +13,31 @@ namespace MediocreBONK::ECS::Components
         Rectangle
     };
 
+    // Collision layers (bit index into Collider::layer / Collider::mask)
+    // CollisionSystem classifies pairs by layer pair instead of comparing tag strings
+    enum class CollisionLayer : uint32_t
+    {
+        Default,
+        Player,
+        Enemy,
+        PlayerProjectile,
+        EnemyProjectile,
+        Pickup,
+        Count
+    };
+
     class Collider : public Component
     {
     public:
+        static uint32_t layerBit(CollisionLayer collisionLayer)
+        {
+            return 1u << static_cast<uint32_t>(collisionLayer);
+        }
         Collider(ColliderShape shape, float radius)
             : shape(shape)
             , radius(radius)
             , size(radius * 2.f, radius * 2.f)
-            , layer(1)
+            , layer(layerBit(CollisionLayer::Default))
             , mask(0xFFFFFFFF) // Collide with all layers by default
             , isTrigger(false)
         {}
@@ -29,7 +46,7 @@ namespace MediocreBONK::ECS::Components
             : shape(shape)
             , radius(0.f)
             , size(size)
-            , layer(1)
+            , layer(layerBit(CollisionLayer::Default))
             , mask(0xFFFFFFFF)
             , isTrigger(false)
         {}
@@ -43,8 +60,10 @@ namespace MediocreBONK::ECS::Components
             if (shape == ColliderShape::Circle && other->shape == ColliderShape::Circle)
             {
                 // Circle-Circle collision
-                float distance = Utils::Math::distance(thisPos, otherPos);
-                return distance < (radius + other->radius);
+                // OPTIMIZATION: Compare squared distances (no sqrt)
+                // Bulk tests go through Utils::CircleNarrowphase instead
+                float radiusSum = radius + other->radius;
+                return Utils::Math::distanceSquared(thisPos, otherPos) < radiusSum * radiusSum;
             }
             else if (shape == ColliderShape::Rectangle && other->shape == ColliderShape::Rectangle)
             {
@@ -67,6 +86,16 @@ namespace MediocreBONK::ECS::Components
             }
         }
 
+        void setLayer(CollisionLayer collisionLayer)
+        {
+            layer = layerBit(collisionLayer);
+        }
+
+        bool isOnLayer(CollisionLayer collisionLayer) const
+        {
+            return (layer & layerBit(collisionLayer)) != 0;
+        }
+
         sf::FloatRect getBounds(const sf::Vector2f& position) const
         {
             if (shape == ColliderShape::Circle)
@@ -87,9 +116,12 @@ namespace MediocreBONK::ECS::Components
         sf::Vector2f size;
         uint32_t layer;
         uint32_t mask;
-        bool isTrigger; // If true, collision detected but no physics response
+        bool isTrigger; // If true, collision detected (events, sensors) but no physics response
 
+        // Contact events (CollisionSystem's contact cache):
+        // Enter once when a contact starts, Stay every following frame, Exit once when it ends
         std::function<void(Entity*)> onCollisionEnter;
+        std::function<void(Entity*)> onCollisionStay;
         std::function<void(Entity*)> onCollisionExit;
 
     private:
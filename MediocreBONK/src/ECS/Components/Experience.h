@@ -34,7 +34,7 @@ namespace MediocreBONK::ECS::Components
             xpToNextLevel = calculateXPForLevel(currentLevel);
 
             // Emit PlayerLevelUp event
-            auto eventData = std::make_unique<Managers::PlayerLevelUpData>();
+            auto eventData = Managers::makeEvent<Managers::PlayerLevelUpData>();
             eventData->newLevel = currentLevel;
             eventData->previousLevel = previousLevel;
             Managers::EventManager::getInstance().queueEvent(
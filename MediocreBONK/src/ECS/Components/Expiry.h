@@ -0,0 +1,22 @@
+#pragma once
+#include "../Component.h"
+#include "../../Utils/TimerWheel.h"
+#include <string>
+
+namespace MediocreBONK::ECS::Components
+{
+    // Entity deactivated by ExpirySystem when its timer fires (no per-frame countdown)
+    // 'tag' is the entity's tag when scheduled: a recycled entity that still
+    // carries this component under another tag is never expired by mistake
+    class Expiry : public Component
+    {
+    public:
+        Expiry(Utils::TimerHandle handle, const std::string& tag)
+            : handle(handle)
+            , tag(tag)
+        {}
+
+        Utils::TimerHandle handle;
+        std::string tag;
+    };
+}
@@ -19,12 +19,9 @@ namespace MediocreBONK::ECS::Components
 
         void takeDamage(float damage)
         {
-            if (invulnerable || currentHealth <= 0.f)
+            if (!applyDamage(damage))
                 return;
 
-            currentHealth -= damage;
-            currentHealth = std::max(0.f, currentHealth);
-
             if (onDamageCallback)
                 onDamageCallback(damage);
 
@@ -32,6 +29,18 @@ namespace MediocreBONK::ECS::Components
                 onDeathCallback();
         }
 
+        // Health change only, no callbacks (DamageSystem notifies after its resolve pass)
+        // Returns false if the damage was ignored (invulnerable or already dead)
+        bool applyDamage(float damage)
+        {
+            if (invulnerable || currentHealth <= 0.f)
+                return false;
+
+            currentHealth -= damage;
+            currentHealth = std::max(0.f, currentHealth);
+            return true;
+        }
+
         void heal(float amount)
         {
             if (currentHealth <= 0.f)
@@ -0,0 +1,58 @@
+#pragma once
+#include "../Component.h"
+#include "Collider.h"
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+namespace MediocreBONK::ECS::Components
+{
+    // One collider inside a sensor this tick
+    struct SensorOverlap
+    {
+        Entity* entity;
+        float distanceSquared; // Sensor center -> collider center
+    };
+
+    /*
+     * OPTIMIZATION TECHNIQUE: SENSOR VOLUMES (overlap-only collision class)
+     *
+     * Problem:
+     * - Magnet radius, pickup radius... were hand-written distance loops:
+     *   every gem measured its distance to the player every frame (O(gems))
+     *
+     * Solution: A circle that only REPORTS overlaps
+     * - CollisionSystem queries the broadphase it already built this tick,
+     *   restricted to the sensor's detectMask layers (one query per sensor)
+     * - Result: one batched list of overlapping colliders per sensor per tick
+     * - No contact response, no separation, no enter/exit bookkeeping
+     * - Separate from Collider: an entity can have a solid body AND a sensor
+     *   (the player's 20px body + its 100px magnet)
+     *
+     * Usage:
+     *   auto* magnet = entity->addComponent<Sensor>(100.f, Collider::layerBit(CollisionLayer::Pickup));
+     *   for (const auto& overlap : magnet->getOverlaps()) { ... }   // Valid until next collision update
+     */
+    class Sensor : public Component
+    {
+    public:
+        Sensor(float radius, uint32_t detectMask)
+            : radius(radius)
+            , detectMask(detectMask)
+            , enabled(true)
+        {}
+
+        // Overlaps found by the last CollisionSystem update (center distance order not guaranteed)
+        const std::vector<SensorOverlap>& getOverlaps() const { return overlaps; }
+
+        float radius;
+        uint32_t detectMask; // Collider layer bits to report
+        bool enabled;
+
+        // Optional: called once per tick with the whole batch (only when not empty)
+        std::function<void(const std::vector<SensorOverlap>&)> onOverlaps;
+
+        // Written by CollisionSystem
+        std::vector<SensorOverlap> overlaps;
+    };
+}
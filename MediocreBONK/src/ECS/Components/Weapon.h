@@ -1,10 +1,24 @@
 #pragma once
 #include "../Component.h"
+#include "../../Utils/Math.h"
 #include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
 
 namespace MediocreBONK::ECS::Components
 {
+    // How one trigger pull turns into projectiles
+    enum class FirePattern
+    {
+        Fan,          // projectileCount shots at once, 'spread' degrees wide, centered on the target
+        Ring,         // projectileCount shots at once, evenly around 360 degrees, first one at the target
+        BurstStream,  // projectileCount shots at the target, one every burstDelay seconds
+        Spiral        // Ring turning by spiralStep degrees every volley (target only triggers it)
+    };
+
     struct WeaponData
     {
         std::string name;
@@ -16,6 +30,84 @@ namespace MediocreBONK::ECS::Components
         float spread;            // angle spread for multiple projectiles (degrees)
         float range;             // max distance or lifetime
         std::string projectileSprite;
+        FirePattern pattern = FirePattern::BurstStream;
+        float burstDelay = 0.05f; // BurstStream: seconds between shots
+        float spiralStep = 0.f;   // Spiral: degrees turned per volley
+    };
+
+    /*
+     * OPTIMIZATION TECHNIQUE: PRECOMPUTED PATTERN TABLE
+     *
+     * Problem:
+     * - Every projectile computed cos/sin of its own spread angle, one shot at a time
+     *
+     * Solution: Expand the pattern ONCE into unit directions relative to the aim
+     * - +X = aim direction; rebuilt (with trig) only when pattern, count or
+     *   spread change (level-up upgrades), never per shot
+     * - A volley rotates the table by the aim vector itself:
+     *   complex multiply (Math::rotate), no angle, no trig
+     * - Spiral: the turn per volley is also stored as a unit vector
+     */
+    class FirePatternTable
+    {
+    public:
+        // Directions of one volley (relative to +X = aim)
+        const std::vector<sf::Vector2f>& getDirections(const WeaponData& data)
+        {
+            if (!built || data.pattern != pattern || data.projectileCount != count || data.spread != spread ||
+                data.spiralStep != spiralStep)
+                rebuild(data);
+            return directions;
+        }
+
+        // Spiral: rotation applied between two volleys (unit vector)
+        const sf::Vector2f& getStepRotation() const { return stepRotation; }
+
+    private:
+        void rebuild(const WeaponData& data)
+        {
+            pattern = data.pattern;
+            count = data.projectileCount;
+            spread = data.spread;
+            spiralStep = data.spiralStep;
+            built = true;
+
+            directions.clear();
+            int shots = std::max(count, 1);
+            switch (pattern)
+            {
+            case FirePattern::Fan:
+            {
+                float step = shots > 1 ? spread / (shots - 1) : 0.f;
+                for (int i = 0; i < shots; ++i)
+                    directions.push_back(unitVector(shots > 1 ? -spread / 2.f + step * i : 0.f));
+                break;
+            }
+            case FirePattern::Ring:
+            case FirePattern::Spiral:
+                for (int i = 0; i < shots; ++i)
+                    directions.push_back(unitVector(360.f * i / shots));
+                break;
+            case FirePattern::BurstStream:
+                directions.push_back({ 1.f, 0.f }); // One shot per burst step, straight at the target
+                break;
+            }
+            stepRotation = unitVector(spiralStep);
+        }
+
+        static sf::Vector2f unitVector(float degrees)
+        {
+            float radians = Utils::Math::toRadians(degrees);
+            return { std::cos(radians), std::sin(radians) };
+        }
+
+        std::vector<sf::Vector2f> directions;
+        sf::Vector2f stepRotation{ 1.f, 0.f };
+        FirePattern pattern = FirePattern::BurstStream;
+        int count = 0;
+        float spread = 0.f;
+        float spiralStep = 0.f;
+        bool built = false;
     };
 
     class Weapon : public Component
@@ -28,7 +120,7 @@ namespace MediocreBONK::ECS::Components
             , autoFire(true)
             , burstShotsRemaining(0)
             , burstTimer(0.f)
-            , burstDelay(0.05f) // 50ms delay between burst shots
+            , spiralRotation(1.f, 0.f)
         {}
 
         void update(sf::Time dt) override
@@ -85,14 +177,27 @@ namespace MediocreBONK::ECS::Components
             data.piercing += amount;
         }
 
+        // Volley directions for the current data (cached, see FirePatternTable)
+        const std::vector<sf::Vector2f>& getVolleyDirections() { return patternTable.getDirections(data); }
+
+        // Spiral: orientation of this volley, then turn for the next one
+        sf::Vector2f nextSpiralRotation()
+        {
+            patternTable.getDirections(data); // Step rotation follows data changes
+            sf::Vector2f current = spiralRotation;
+            spiralRotation = Utils::Math::normalize(Utils::Math::rotate(spiralRotation, patternTable.getStepRotation()));
+            return current;
+        }
+
         WeaponData data;
         bool autoFire;
         int burstShotsRemaining;
         float burstTimer;
-        float burstDelay;
 
     private:
         float fireTimer;
         bool canFire;
+        FirePatternTable patternTable;
+        sf::Vector2f spiralRotation; // Unit vector, advanced every Spiral volley
     };
 }
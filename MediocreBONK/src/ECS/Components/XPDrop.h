@@ -0,0 +1,16 @@
+#pragma once
+#include "../Component.h"
+
+namespace MediocreBONK::ECS::Components
+{
+    // Experience dropped as an XP gem when the entity dies (read by DeathSystem)
+    class XPDrop : public Component
+    {
+    public:
+        XPDrop(float experienceValue)
+            : experienceValue(experienceValue)
+        {}
+
+        float experienceValue;
+    };
+}
@@ -45,7 +45,7 @@ namespace MediocreBONK::ECS
     class Entity
     {
     public:
-        Entity(uint64_t id) : id(id), active(true) {}
+        Entity(uint64_t id) : id(id), active(true), dormant(false) {}
         ~Entity() = default;
 
         // ECS: Add a component to this entity
@@ -138,10 +138,15 @@ namespace MediocreBONK::ECS
         // Getters
         uint64_t getId() const { return id; }
         bool isActive() const { return active; }
+        bool isDormant() const { return dormant; }
 
         // Setters
         void setActive(bool isActive) { active = isActive; }
 
+        // Dormant: still active (tag lists, rendering, timers) but skipped by
+        // EntityManager::update and the collision broadphase (see DormancySystem)
+        void setDormant(bool isDormant) { dormant = isDormant; }
+
         // ENTITY CATEGORIZATION:
         // tag: String identifier for entity type ("Player", "Enemy", "XPGem")
         // layer: Integer for rendering order or collision groups
@@ -151,6 +156,7 @@ namespace MediocreBONK::ECS
     private:
         uint64_t id;     // Unique identifier
         bool active;     // Entity can be deactivated without destroying it (pooling)
+        bool dormant;    // Asleep: not updated, not in the broadphase
 
         // Component storage: type -> component instance
         // std::type_index allows runtime type lookup
@@ -1,9 +1,14 @@
 #pragma once
 #include "Entity.h"
+#include "Components/Transform.h"
 #include "../Utils/Logger.h"
+#include "../Utils/Morton.h"
+#include "../Utils/FrameArena.h"
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <unordered_map>
+#include <cstdint>
 
 namespace MediocreBONK::ECS
 {
@@ -40,10 +45,22 @@ namespace MediocreBONK::ECS
      *   // Later:
      *   entityManager->destroyEntity(entity); // Marks inactive (pooled)
      *
+     * OPTIMIZATION TECHNIQUE: SPATIAL SORT (Z-order)
+     * - Entities are created in spawn order: neighbours in the world are
+     *   scattered through the storage vector
+     * - Every spatial pass copies entities in storage order (collision proxies,
+     *   separation SoA, tag lists for rendering), so those arrays were scattered too
+     * - Optionally the storage vector is re-sorted by Morton code of position:
+     *   at every compaction (default) or at a fixed interval (setSpatialSort)
+     * - Handles stay stable: Entity objects never move (only their unique_ptr
+     *   slot does), IDs and Entity* stay valid, idIndex is untouched
+     * - Draw order inside one tag can change after a sort (no z-order in the game yet)
+     *
      * Query Interface:
      * - getEntitiesByTag("Enemy"): Returns all enemies
      * - getEntitiesWithComponent<Health>(): Returns all entities with Health
      * - getEntitiesWithComponents<Transform, Health>(): Multiple components
+     *   (component queries return a Utils::FrameVector: valid for this frame only)
      */
     class EntityManager
     {
@@ -53,6 +70,11 @@ namespace MediocreBONK::ECS
             , nextId(0)
             , cleanupTimer(0.f)
             , cleanupInterval(0.5f) // Cleanup every 0.5 seconds
+            , maintenanceRequested(false)
+            , maintenanceElapsed(0.f)
+            , spatialSortEnabled(true)
+            , spatialSortInterval(0.f) // Sort when cleanup compacts storage
+            , spatialSortTimer(0.f)
             , tagCacheDirty(true) // Start dirty to build cache on first update
         {
             entities.reserve(maxEntities); // Pre-allocate vector capacity
@@ -79,6 +101,7 @@ namespace MediocreBONK::ECS
                 if (it != entities.end())
                 {
                     (*it)->setActive(true); // Reactivate pooled entity
+                    (*it)->setDormant(false);
                     Utils::Logger::info("Reused entity ID: " + std::to_string((*it)->getId()));
                     return it->get();
                 }
@@ -92,6 +115,7 @@ namespace MediocreBONK::ECS
             auto entity = std::make_unique<Entity>(nextId++);
             Entity* ptr = entity.get();
             entities.push_back(std::move(entity));
+            idIndex[ptr->getId()] = ptr;
 
             // OPTIMIZATION: Mark cache dirty since we added an entity
             tagCacheDirty = true;
@@ -100,14 +124,14 @@ namespace MediocreBONK::ECS
         }
 
         // Get entity by ID
+        // OPTIMIZATION: O(1) hash lookup instead of a linear search
+        // Returns nullptr once the entity has been cleaned up
         Entity* getEntity(uint64_t id)
         {
-            auto it = std::find_if(entities.begin(), entities.end(),
-                [id](const std::unique_ptr<Entity>& e) { return e->getId() == id; });
-
-            if (it != entities.end())
+            auto it = idIndex.find(id);
+            if (it != idIndex.end())
             {
-                return it->get();
+                return it->second;
             }
             return nullptr;
         }
@@ -178,10 +202,11 @@ namespace MediocreBONK::ECS
 
         // ECS QUERY: Get entities with specific component type
         // Used by systems to process entities (e.g., CollisionSystem queries all Collider entities)
+        // Result lives in the frame arena (see Utils::FrameArena): use it, don't keep it
         template<typename T>
-        std::vector<Entity*> getEntitiesWithComponent()
+        Utils::FrameVector<Entity*> getEntitiesWithComponent()
         {
-            std::vector<Entity*> result;
+            auto result = Utils::makeFrameVector<Entity*>(entities.size());
             for (auto& entity : entities)
             {
                 if (entity->isActive() && entity->hasComponent<T>())
@@ -196,9 +221,9 @@ namespace MediocreBONK::ECS
         // Example: getEntitiesWithComponents<Transform, Health, Sprite>()
         // Returns only entities that have ALL specified components
         template<typename T1, typename T2, typename... Rest>
-        std::vector<Entity*> getEntitiesWithComponents()
+        Utils::FrameVector<Entity*> getEntitiesWithComponents()
         {
-            std::vector<Entity*> result;
+            auto result = Utils::makeFrameVector<Entity*>(entities.size());
             for (auto& entity : entities)
             {
                 if (entity->isActive() &&
@@ -218,11 +243,21 @@ namespace MediocreBONK::ECS
             // OBJECT POOLING: Periodically clean up inactive entities
             // This prevents the pool from growing unbounded
             // MUST be done BEFORE rebuilding cache to avoid dangling pointers
-            cleanupTimer += dt.asSeconds();
-            if (cleanupTimer >= cleanupInterval)
+            // (cleanupInterval <= 0: driven by requestMaintenance(), e.g. a FrameScheduler job)
+            if (cleanupInterval > 0.f)
             {
-                cleanupInactiveEntities();
-                cleanupTimer = 0.f;
+                cleanupTimer += dt.asSeconds();
+                if (cleanupTimer >= cleanupInterval)
+                {
+                    cleanupTimer = 0.f;
+                    runMaintenance(cleanupInterval);
+                }
+            }
+            else if (maintenanceRequested)
+            {
+                maintenanceRequested = false;
+                runMaintenance(maintenanceElapsed);
+                maintenanceElapsed = 0.f;
             }
 
             // OPTIMIZATION: Only rebuild tag cache when dirty (entities created/destroyed)
@@ -243,16 +278,35 @@ namespace MediocreBONK::ECS
                 tagCacheDirty = false;
             }
 
-            // Update all active entities
+            // Update all active entities (dormant ones sleep until DormancySystem wakes them)
             for (auto& entity : entities)
             {
-                if (entity->isActive())
+                if (entity->isActive() && !entity->isDormant())
                 {
                     entity->update(dt);
                 }
             }
         }
 
+        // Cleanup + spatial sort at the start of the next update()
+        // (compaction frees entities: never in the middle of other systems' work,
+        // their tag lists stay valid until update() rebuilds the cache)
+        // 'elapsed' = seconds since the previous request
+        void requestMaintenance(float elapsed)
+        {
+            maintenanceRequested = true;
+            maintenanceElapsed += elapsed;
+        }
+
+        // interval <= 0: no internal cleanup timer, the owner calls requestMaintenance()
+        void setCleanupInterval(float interval)
+        {
+            cleanupInterval = interval;
+            cleanupTimer = 0.f;
+        }
+
+        float getCleanupInterval() const { return cleanupInterval; }
+
         // OBJECT POOLING: Actually remove inactive entities from memory
         // This is the cleanup phase that frees memory
         void cleanupInactiveEntities()
@@ -265,6 +319,13 @@ namespace MediocreBONK::ECS
             if (inactiveCount < 10)
                 return;
 
+            // Drop removed entities from the ID index first (pointers still valid here)
+            for (const auto& entity : entities)
+            {
+                if (!entity->isActive())
+                    idIndex.erase(entity->getId());
+            }
+
             // Erase-remove idiom: remove inactive entities from vector
             entities.erase(
                 std::remove_if(entities.begin(), entities.end(),
@@ -284,6 +345,64 @@ namespace MediocreBONK::ECS
             }
         }
 
+        // Spatial sort of entity storage
+        // interval <= 0: sort whenever cleanup compacts storage, > 0: sort every 'interval' seconds
+        void setSpatialSort(bool enabled, float interval = 0.f)
+        {
+            spatialSortEnabled = enabled;
+            spatialSortInterval = interval;
+            spatialSortTimer = 0.f;
+        }
+
+        // Reorder storage along a Z-order curve of positions
+        // Entities without a Transform go last; ties keep ID order (deterministic)
+        void sortBySpatialLocality()
+        {
+            static constexpr float CellSize = 64.f; // ~ two enemy diameters
+
+            if (entities.size() < 2)
+                return;
+
+            // Codes are relative to the min corner (positions can be negative)
+            sf::Vector2f origin(0.f, 0.f);
+            bool first = true;
+            for (const auto& entity : entities)
+            {
+                if (auto* transform = entity->getComponent<Components::Transform>())
+                {
+                    origin = first ? transform->position
+                                   : sf::Vector2f(std::min(origin.x, transform->position.x),
+                                                  std::min(origin.y, transform->position.y));
+                    first = false;
+                }
+            }
+
+            sortKeys.clear();
+            for (uint32_t i = 0; i < entities.size(); ++i)
+            {
+                auto* transform = entities[i]->getComponent<Components::Transform>();
+                uint64_t code = transform ? Utils::Morton::encode(transform->position, origin, CellSize)
+                                          : UINT64_MAX;
+                sortKeys.push_back({ code, entities[i]->getId(), i });
+            }
+
+            auto byCode = [](const SortKey& a, const SortKey& b) {
+                return a.code != b.code ? a.code < b.code : a.id < b.id;
+            };
+            if (std::is_sorted(sortKeys.begin(), sortKeys.end(), byCode))
+                return;
+            std::sort(sortKeys.begin(), sortKeys.end(), byCode);
+
+            // Permute the unique_ptr slots (Entity objects stay where they are)
+            sortBuffer.clear();
+            for (const auto& key : sortKeys)
+                sortBuffer.push_back(std::move(entities[key.index]));
+            entities.swap(sortBuffer);
+            sortBuffer.clear();
+
+            tagCacheDirty = true;
+        }
+
         // Render all active entities
         void render(sf::RenderWindow& window)
         {
@@ -300,6 +419,7 @@ namespace MediocreBONK::ECS
         void clear()
         {
             entities.clear();
+            idIndex.clear();
             nextId = 0;
             Utils::Logger::info("EntityManager cleared");
         }
@@ -317,9 +437,33 @@ namespace MediocreBONK::ECS
         }
 
     private:
+        // Cleanup + spatial sort ('elapsed' = seconds since the previous run)
+        void runMaintenance(float elapsed)
+        {
+            size_t before = entities.size();
+            cleanupInactiveEntities();
+            bool compacted = entities.size() != before;
+
+            // SPATIAL SORT: Piggyback on compaction, or run at a fixed interval
+            // (before the tag cache rebuild so tag lists follow the new order)
+            if (spatialSortEnabled)
+            {
+                spatialSortTimer += elapsed;
+                bool due = spatialSortInterval > 0.f ? spatialSortTimer >= spatialSortInterval : compacted;
+                if (due)
+                {
+                    sortBySpatialLocality();
+                    spatialSortTimer = 0.f;
+                }
+            }
+        }
+
         // Entity storage: vector of unique_ptr for contiguous memory (cache-friendly)
         std::vector<std::unique_ptr<Entity>> entities;
 
+        // ID -> entity (Entity objects never move, only their unique_ptr does)
+        std::unordered_map<uint64_t, Entity*> idIndex;
+
         // OBJECT POOLING: Entity cap prevents unbounded growth
         size_t maxEntities;
 
@@ -329,6 +473,21 @@ namespace MediocreBONK::ECS
         // OBJECT POOLING: Cleanup timing
         float cleanupTimer;
         float cleanupInterval;
+        bool maintenanceRequested;
+        float maintenanceElapsed;
+
+        // SPATIAL SORT: Settings + reused buffers
+        struct SortKey
+        {
+            uint64_t code;   // Morton code of the position
+            uint64_t id;     // Tie break
+            uint32_t index;  // Slot before sorting
+        };
+        bool spatialSortEnabled;
+        float spatialSortInterval;
+        float spatialSortTimer;
+        std::vector<SortKey> sortKeys;
+        std::vector<std::unique_ptr<Entity>> sortBuffer;
 
         // CACHING: Tag-to-entities map for fast tag queries
         // Rebuilt only when dirty flag is set (entities created/destroyed)
@@ -5,6 +5,7 @@
 #include "../ECS/Components/Health.h"
 #include "../ECS/Components/AI.h"
 #include "../ECS/Components/Collider.h"
+#include "../ECS/Components/XPDrop.h"
 #include <SFML/Graphics.hpp>
 
 // Forward declaration to avoid circular dependency
@@ -32,33 +33,59 @@ namespace MediocreBONK::Entities
         float radius; // For collider
         sf::Color color; // Visual distinction
         EnemyType type;
+        // Movement (AISystem runs each behaviour as one batch: mixing types is cheap)
+        ECS::Components::AIBehavior behavior = ECS::Components::AIBehavior::ChasePlayer;
     };
 
     class Enemy
     {
     public:
         Enemy(ECS::Entity* entity, const sf::Vector2f& position, const EnemyData& data, ECS::Entity* player)
-            : entity(entity)
-            , data(data)
-            , onDeathXPCallback(nullptr)
         {
-            // Add components
+            initialize(entity, position, data, player);
+        }
+
+        // (Re)bind this wrapper to an entity: pooled wrappers are reused by SpawnSystem
+        void initialize(ECS::Entity* newEntity, const sf::Vector2f& position, const EnemyData& newData, ECS::Entity* player)
+        {
+            entity = newEntity;
+            entityId = newEntity->getId();
+            data = newData;
+
+            // Add components (replaces the ones a recycled entity still carries)
             transform = entity->addComponent<ECS::Components::Transform>(position);
             physics = entity->addComponent<ECS::Components::Physics>(1.f, 0.9f);
             health = entity->addComponent<ECS::Components::Health>(data.maxHealth);
-            ai = entity->addComponent<ECS::Components::AI>(ECS::Components::AIBehavior::ChasePlayer, data.speed);
+            ai = entity->addComponent<ECS::Components::AI>(data.behavior, data.speed);
+            ai->orbitDirection = (entityId % 2 == 0) ? 1.f : -1.f; // Ranged / Circle: mix both directions
             collider = entity->addComponent<ECS::Components::Collider>(ECS::Components::ColliderShape::Circle, data.radius);
+            collider->setLayer(ECS::Components::CollisionLayer::Enemy);
+            entity->addComponent<ECS::Components::XPDrop>(data.experienceValue);
 
             // Set AI target
             ai->setTarget(player);
 
-            // Set up health callbacks
-            health->onDeathCallback = [this]() { onDeath(); };
+            // Deaths are handled in batches by DeathSystem (XP drop, kill count, effects)
             health->onDamageCallback = [this](float damage) { onDamage(damage); };
 
             entity->tag = "Enemy";
         }
 
+        // Unbind from the entity before the wrapper goes back to the pool
+        // entityExists = false when EntityManager already freed the entity (nothing to touch)
+        void release(bool entityExists)
+        {
+            if (entityExists && health)
+                health->onDamageCallback = nullptr; // Captures 'this'
+
+            entity = nullptr;
+            transform = nullptr;
+            physics = nullptr;
+            health = nullptr;
+            ai = nullptr;
+            collider = nullptr;
+        }
+
         virtual ~Enemy() = default;
 
         virtual void update(sf::Time dt)
@@ -71,43 +98,24 @@ namespace MediocreBONK::Entities
             // Override in derived classes for spawn effects
         }
 
-        virtual void onDeath()
-        {
-            // Spawn XP gem through callback
-            if (onDeathXPCallback && transform)
-            {
-                onDeathXPCallback(transform->position, data.experienceValue);
-            }
-
-            // Play death animation/particles 
-
-            // Deactivate entity
-            entity->setActive(false);
-        }
-
-        void setOnDeathXPCallback(std::function<void(sf::Vector2f, float)> callback)
-        {
-            onDeathXPCallback = callback;
-        }
-
         virtual void onDamage(float damage)
         {
             // Flash effect or damage animation (will implement later)
         }
 
         ECS::Entity* getEntity() { return entity; }
+        uint64_t getEntityId() const { return entityId; }
         const EnemyData& getData() const { return data; }
 
     protected:
-        ECS::Entity* entity;
-        ECS::Components::Transform* transform;
-        ECS::Components::Physics* physics;
-        ECS::Components::Health* health;
-        ECS::Components::AI* ai;
-        ECS::Components::Collider* collider;
+        ECS::Entity* entity = nullptr;
+        uint64_t entityId = 0; // Handle: stays valid after the entity is freed
+        ECS::Components::Transform* transform = nullptr;
+        ECS::Components::Physics* physics = nullptr;
+        ECS::Components::Health* health = nullptr;
+        ECS::Components::AI* ai = nullptr;
+        ECS::Components::Collider* collider = nullptr;
         EnemyData data;
-
-        std::function<void(sf::Vector2f, float)> onDeathXPCallback;
     };
 
     // Factory class for creating enemies
@@ -156,6 +164,9 @@ namespace MediocreBONK::Entities
             return data;
         }
 
+        // Base stats of 'type' scaled by the current difficulty
+        static EnemyData getScaledData(EnemyType type);
+
         static std::unique_ptr<Enemy> create(ECS::EntityManager* entityManager,
                                              EnemyType type,
                                              const sf::Vector2f& position,
@@ -168,15 +179,8 @@ namespace MediocreBONK::Entities
 
 namespace MediocreBONK::Entities
 {
-    inline std::unique_ptr<Enemy> EnemyFactory::create(ECS::EntityManager* entityManager,
-                                                         EnemyType type,
-                                                         const sf::Vector2f& position,
-                                                         ECS::Entity* player)
+    inline EnemyData EnemyFactory::getScaledData(EnemyType type)
     {
-        auto* entity = entityManager->createEntity();
-        if (!entity)
-            return nullptr;
-
         EnemyData data;
         switch (type)
         {
@@ -221,6 +225,18 @@ namespace MediocreBONK::Entities
             break;
         }
 
-        return std::make_unique<Enemy>(entity, position, data, player);
+        return data;
+    }
+
+    inline std::unique_ptr<Enemy> EnemyFactory::create(ECS::EntityManager* entityManager,
+                                                         EnemyType type,
+                                                         const sf::Vector2f& position,
+                                                         ECS::Entity* player)
+    {
+        auto* entity = entityManager->createEntity();
+        if (!entity)
+            return nullptr;
+
+        return std::make_unique<Enemy>(entity, position, getScaledData(type), player);
     }
 }
@@ -41,7 +41,8 @@ namespace MediocreBONK::Entities
             health = entity->addComponent<ECS::Components::Health>(100.f);
 
             // Add collider (circle shape)
-            entity->addComponent<ECS::Components::Collider>(ECS::Components::ColliderShape::Circle, 20.f);
+            auto* collider = entity->addComponent<ECS::Components::Collider>(ECS::Components::ColliderShape::Circle, 20.f);
+            collider->setLayer(ECS::Components::CollisionLayer::Player);
 
             // Add basic weapon
             ECS::Components::WeaponData weaponData;
@@ -54,6 +55,8 @@ namespace MediocreBONK::Entities
             weaponData.spread = 0.f;
             weaponData.range = 1300.f; // Increased to reach enemies at spawn distance (~1151px)
             weaponData.projectileSprite = "assets/sprites/projectile.png";
+            weaponData.pattern = ECS::Components::FirePattern::BurstStream; // Multi-Shot = longer stream
+            weaponData.burstDelay = 0.05f; // 50ms between stream shots
 
             auto* weapon = entity->addComponent<ECS::Components::Weapon>(weaponData);
             weapon->autoFire = true; // Enable auto-fire
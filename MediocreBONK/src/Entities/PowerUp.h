@@ -39,31 +39,57 @@ namespace MediocreBONK::Entities
     public:
         PowerUp(ECS::Entity* entity, const sf::Vector2f& position, const PowerUpData& data, ECS::EntityManager* entityManager)
             : entity(entity)
+            , entityId(entity->getId())
             , data(data)
             , entityManager(entityManager)
-            , lifetime(30.f) // PowerUps despawn after 30 seconds
+            , bobTime(0.f)
             , collected(false)
         {
             // Add components
             transform = entity->addComponent<ECS::Components::Transform>(position);
             collider = entity->addComponent<ECS::Components::Collider>(
                 ECS::Components::ColliderShape::Circle, data.radius);
+            collider->setLayer(ECS::Components::CollisionLayer::Pickup);
+            collider->isTrigger = true; // Overlap events only, never pushed around
+
+            // Collected when the player touches it (dispatched by CollisionSystem's player-pickup pass)
+            collider->onCollisionEnter = [this](ECS::Entity* other) {
+                if (other->tag == "Player")
+                    collect(other);
+            };
 
             entity->tag = "PowerUp";
         }
 
+        ~PowerUp()
+        {
+            // Entity outlives this wrapper (pooled), don't leave a dangling callback behind
+            if (collider)
+                collider->onCollisionEnter = nullptr;
+        }
+
+        // Unbind from the entity before the wrapper goes back to the pool
+        // ownsComponents = false when the entity was freed or reused as something
+        // else: its components (and our cached pointers) are gone, touch nothing
+        void release(bool ownsComponents)
+        {
+            if (ownsComponents && collider)
+                collider->onCollisionEnter = nullptr; // Captures 'this'
+
+            entity = nullptr;
+            transform = nullptr;
+            collider = nullptr;
+        }
+
         void update(sf::Time dt)
         {
-            lifetime -= dt.asSeconds();
-            if (lifetime <= 0.f)
-            {
-                entity->setActive(false);
-            }
+            // Despawn is an ExpirySystem timer (see PowerUpSystem)
+            bobTime += dt.asSeconds();
 
             // Floating animation (simple sine wave)
             if (transform)
             {
-                float floatOffset = std::sin(lifetime * 3.f) * 5.f;
+                float floatOffset = std::sin(bobTime * 3.f) * 5.f;
                 transform->position.y += floatOffset * dt.asSeconds();
             }
         }
@@ -79,7 +105,7 @@ namespace MediocreBONK::Entities
             applyEffect(player);
 
             // Emit event
-            auto eventData = std::make_unique<Managers::BuffAppliedData>();
+            auto eventData = Managers::makeEvent<Managers::BuffAppliedData>();
             eventData->buffName = data.name;
             eventData->duration = data.duration;
             Managers::EventManager::getInstance().queueEvent(
@@ -92,6 +118,7 @@ namespace MediocreBONK::Entities
         PowerUpType getType() const { return data.type; }
         const PowerUpData& getData() const { return data; }
         ECS::Entity* getEntity() { return entity; }
+        uint64_t getEntityId() const { return entityId; }
         bool isCollected() const { return collected; }
 
     private:
@@ -227,11 +254,12 @@ namespace MediocreBONK::Entities
         }
 
         ECS::Entity* entity;
+        uint64_t entityId; // Handle: stays valid after the entity is freed
         ECS::EntityManager* entityManager;
         ECS::Components::Transform* transform;
         ECS::Components::Collider* collider;
         PowerUpData data;
-        float lifetime;
+        float bobTime; // Animation clock
         bool collected;
     };
 
@@ -323,14 +351,8 @@ namespace MediocreBONK::Entities
             };
         }
 
-        static std::unique_ptr<PowerUp> create(ECS::EntityManager* entityManager,
-                                               PowerUpType type,
-                                               const sf::Vector2f& position)
+        static PowerUpData getData(PowerUpType type)
         {
-            auto* entity = entityManager->createEntity();
-            if (!entity)
-                return nullptr;
-
             PowerUpData data;
             switch (type)
             {
@@ -357,7 +379,18 @@ namespace MediocreBONK::Entities
                 break;
             }
 
-            return std::make_unique<PowerUp>(entity, position, data, entityManager);
+            return data;
+        }
+
+        static std::unique_ptr<PowerUp> create(ECS::EntityManager* entityManager,
+                                               PowerUpType type,
+                                               const sf::Vector2f& position)
+        {
+            auto* entity = entityManager->createEntity();
+            if (!entity)
+                return nullptr;
+
+            return std::make_unique<PowerUp>(entity, position, getData(type), entityManager);
         }
     };
 }
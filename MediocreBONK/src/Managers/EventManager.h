@@ -1,10 +1,12 @@
 #pragma once
+#include "../Utils/ObjectPool.h"
 #include <string>
 #include <functional>
 #include <unordered_map>
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <type_traits>
 #include <SFML/System/Vector2.hpp>
 
 namespace MediocreBONK::Managers
@@ -69,10 +71,12 @@ namespace MediocreBONK::Managers
     };
 
     // Specific event data types
+    // Queued once per tick with every kill of that tick (DeathSystem batches deaths)
+    // Positions: DeathSystem::getLastDeaths() (no per-tick list in the payload)
     struct EnemyKilledData : EventData
     {
-        float experienceValue;
-        sf::Vector2f position;
+        int count;
+        float experienceValue;              // Total of the batch
     };
 
     struct PlayerLevelUpData : EventData
@@ -106,6 +110,42 @@ namespace MediocreBONK::Managers
         float duration;
     };
 
+    // Frees a queued payload: back to its type's pool (makeEvent) or plain delete
+    struct EventDeleter
+    {
+        void (*recycle)(EventData*) = nullptr;
+
+        void operator()(EventData* data) const
+        {
+            if (recycle)
+                recycle(data);
+            else
+                delete data;
+        }
+    };
+
+    using EventPtr = std::unique_ptr<EventData, EventDeleter>;
+
+    // OBJECT POOL: one pool per payload type, shared by every producer
+    // Never destroyed: payloads may still be queued while statics are torn down
+    template<typename T>
+    Utils::ObjectPool<T>& eventPool()
+    {
+        static auto* pool = new Utils::ObjectPool<T>(16);
+        return *pool;
+    }
+
+    // Pooled event payload: queueEvent(type, makeEvent<PlayerLevelUpData>())
+    // The slot returns to eventPool<T>() once processEvents() has delivered it
+    template<typename T>
+    std::unique_ptr<T, EventDeleter> makeEvent()
+    {
+        static_assert(std::is_base_of<EventData, T>::value, "Event payloads derive from EventData");
+        return std::unique_ptr<T, EventDeleter>(eventPool<T>().create(), EventDeleter{ [](EventData* data) {
+            eventPool<T>().release(static_cast<T*>(data));
+        } });
+    }
+
     // Event listener (callback) type
     // Function that takes event data and returns nothing
     using EventListener = std::function<void(const EventData*)>;
@@ -166,11 +206,17 @@ namespace MediocreBONK::Managers
         // PUB-SUB: Queue event for later processing (deferred)
         // Safer: Events processed at controlled time (end of frame)
         // Avoids mid-update modification issues
-        void queueEvent(GameEventType eventType, std::unique_ptr<EventData> data = nullptr)
+        void queueEvent(GameEventType eventType, EventPtr data = nullptr)
         {
             eventQueue.emplace_back(eventType, std::move(data));
         }
 
+        // Heap-allocated payload (deleted after delivery); prefer makeEvent<T>()
+        void queueEvent(GameEventType eventType, std::unique_ptr<EventData> data)
+        {
+            queueEvent(eventType, EventPtr(data.release()));
+        }
+
         // Process all queued events (called once per frame)
         // This is when deferred events actually fire
         void processEvents()
@@ -207,7 +253,7 @@ namespace MediocreBONK::Managers
 
         // DEFERRED EXECUTION: Queue of events to process later
         // Prevents mid-update modification issues
-        std::vector<std::pair<GameEventType, std::unique_ptr<EventData>>> eventQueue;
+        std::vector<std::pair<GameEventType, EventPtr>> eventQueue;
 
         // ID generator for unique listener IDs
         int nextListenerId;
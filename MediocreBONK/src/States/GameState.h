@@ -7,6 +7,10 @@
 #include "../Managers/DifficultyManager.h"
 #include "../Managers/EventManager.h"
 #include "../Managers/AudioManager.h"
+#include "../Systems/BulletSystem.h"
+#include "../Systems/DamageSystem.h"
+#include "../Systems/DeathSystem.h"
+#include "../Systems/ExpirySystem.h"
 #include "../Systems/WeaponSystem.h"
 #include "../Systems/CollisionSystem.h"
 #include "../Systems/SpawnSystem.h"
@@ -14,12 +18,16 @@
 #include "../Systems/PowerUpSystem.h"
 #include "../Systems/ParticleSystem.h"
 #include "../Systems/WorldGenerator.h"
+#include "../Systems/PathingSystem.h"
+#include "../Systems/AISystem.h"
+#include "../Systems/DormancySystem.h"
 #include "../UI/HUD.h"
 #include "../UI/LevelUpMenu.h"
 #include "../UI/NotificationManager.h"
 #include "../Managers/UpgradeManager.h"
 #include "../Utils/Logger.h"
 #include "../Utils/Profiler.h"
+#include "../Utils/FrameScheduler.h"
 #include <memory>
 
 // Forward declarations to avoid circular dependencies
@@ -36,13 +44,20 @@ namespace MediocreBONK::States
     public:
         GameState()
             : entityManager(std::make_unique<ECS::EntityManager>())
+            , bulletSystem(std::make_unique<Systems::BulletSystem>())
+            , damageSystem(std::make_unique<Systems::DamageSystem>())
             , weaponSystem(nullptr)
             , collisionSystem(nullptr)
             , spawnSystem(nullptr)
             , xpSystem(nullptr)
             , powerUpSystem(nullptr)
             , particleSystem(nullptr)
+            , deathSystem(nullptr)
+            , expirySystem(nullptr)
+            , scheduler(std::make_unique<Utils::FrameScheduler>())
             , worldGenerator(std::make_unique<Systems::WorldGenerator>(1000.f))
+            , pathingSystem(nullptr)
+            , aiSystem(nullptr)
             , hud(nullptr)
             , levelUpMenu(std::make_unique<UI::LevelUpMenu>())
             , player(nullptr)
@@ -75,22 +90,68 @@ namespace MediocreBONK::States
             // Note: Sound/music files would be loaded here once assets are sourced
 
             // Create player entity
+            const sf::Vector2f playerSpawn(960.f, 300.f);
             auto* playerEntity = entityManager->createEntity();
-            player = std::make_unique<Entities::Player>(playerEntity, sf::Vector2f(960.f, 300.f));
+            player = std::make_unique<Entities::Player>(playerEntity, playerSpawn);
+
+            // Keep the spawn area free of rocks/walls
+            worldGenerator->setSafeZone(playerSpawn, 250.f);
 
             // Initialize systems (needs player to be created first)
-            weaponSystem = std::make_unique<Systems::WeaponSystem>(entityManager.get());
+            weaponSystem = std::make_unique<Systems::WeaponSystem>(entityManager.get(), bulletSystem.get());
             collisionSystem = std::make_unique<Systems::CollisionSystem>(entityManager.get());
+            collisionSystem->setStaticWorld(worldGenerator.get());
+            collisionSystem->setBulletSystem(bulletSystem.get());
+            collisionSystem->setDamageSystem(damageSystem.get());
+            weaponSystem->setCollisionSystem(collisionSystem.get());
             spawnSystem = std::make_unique<Systems::SpawnSystem>(
                 entityManager.get(), player->getEntity(), spawnRadius, despawnDistance);
             xpSystem = std::make_unique<Systems::XPSystem>(entityManager.get(), player->getEntity());
             powerUpSystem = std::make_unique<Systems::PowerUpSystem>(entityManager.get(), player->getEntity());
             particleSystem = std::make_unique<Systems::ParticleSystem>(entityManager.get());
 
-            // Connect spawn system to XP system (enemies drop XP on death)
-            spawnSystem->setOnEnemyDeathXPCallback([this](sf::Vector2f pos, float value) {
-                xpSystem->spawnXPGem(pos, value);
-                hud->incrementKillCount(); // Increment kill count when enemy dies
+            // Gem and power-up lifetimes run on one timer wheel
+            expirySystem = std::make_unique<Systems::ExpirySystem>(entityManager.get());
+            xpSystem->setExpirySystem(expirySystem.get());
+            powerUpSystem->setExpirySystem(expirySystem.get());
+
+            // Periodic work runs as staggered jobs (phases chosen so heavy jobs don't share a tick)
+            entityManager->setCleanupInterval(0.f);
+            scheduler->add("Entity Maintenance", 0.5f, 400.f,
+                [this](uint32_t, uint32_t) { entityManager->requestMaintenance(0.5f); });
+            scheduler->add("Perf Dump", 5.f, 300.f,
+                [this](uint32_t, uint32_t) { logPerformance(); });
+            spawnSystem->setScheduler(scheduler.get());
+            powerUpSystem->setScheduler(scheduler.get());
+
+            // Chasers share one flow field toward the player (routes around obstacles)
+            pathingSystem = std::make_unique<Systems::PathingSystem>(
+                entityManager.get(), player->getEntity(), worldGenerator.get());
+            scheduler->add("Flow Field", 0.1f, 250.f,
+                [this](uint32_t, uint32_t) { pathingSystem->update(); });
+            spawnSystem->setFlowField(pathingSystem->getFlowField());
+
+            // AI thinks at a rate that depends on distance to the camera
+            aiSystem = std::make_unique<Systems::AISystem>(entityManager.get());
+
+            // Idle entities far from the player sleep (no update, no broadphase) until it comes back
+            dormancySystem = std::make_unique<Systems::DormancySystem>(entityManager.get(), player->getEntity());
+            dormancySystem->setRule("PowerUp", viewHalfDiagonal + 200.f, viewHalfDiagonal + 100.f);
+            dormancySystem->setRule("Enemy", 1550.f, 1500.f, [](ECS::Entity* enemy) { // Wake = AI::detectionRange
+                auto* ai = enemy->getComponent<ECS::Components::AI>();
+                return !ai || ai->isIdle();
+            });
+            scheduler->add("Dormancy", 0.25f, 150.f, [this](uint32_t, uint32_t) {
+                // Gems wake well before they reach the magnet (its radius follows buffs)
+                float magnetRadius = xpSystem->getMagnetRadius();
+                dormancySystem->setRule("XPGem", magnetRadius + 300.f, magnetRadius + 200.f);
+                dormancySystem->sleepIdle();
+            });
+
+            // Deaths of each tick are processed in one batch (XP drops, effects, kill count)
+            deathSystem = std::make_unique<Systems::DeathSystem>(xpSystem.get(), particleSystem.get());
+            deathSystem->setOnKills([this](int count) {
+                hud->addKillCount(count);
             });
 
             // Initialize HUD
@@ -185,6 +246,10 @@ namespace MediocreBONK::States
         {
             Utils::Logger::info("Exited Game State");
             entityManager->clear();
+            bulletSystem->clear();
+            damageSystem->clear();
+            expirySystem->clear();
+            scheduler->clear();
         }
 
         void update(sf::Time dt) override
@@ -236,20 +301,44 @@ namespace MediocreBONK::States
                 }
             }
 
+            // Periodic jobs due this tick (maintenance requested here runs in entityManager->update)
+            scheduler->tick();
+
+            // Sleepers the player came close to rejoin this tick's update and collision
+            dormancySystem->update();
+
+            // AI decisions (LOD tiers around the camera), applied before physics integrates
+            auto& camera = Managers::CameraManager::getInstance();
+            aiSystem->setView(camera.getGameView().getCenter(), camera.getViewHalfDiagonal());
+            aiSystem->update(dt);
+
             // Update all entities
             Utils::Profiler::start("Entities Update");
             entityManager->update(dt);
             Utils::Profiler::stop("Entities Update");
 
-            // Update systems
-            Utils::Profiler::start("WeaponSystem");
-            weaponSystem->update(dt);
-            Utils::Profiler::stop("WeaponSystem");
+            // Move projectiles (swept by CollisionSystem below)
+            bulletSystem->update(dt);
+
+            // Expire gems / power-ups whose timers fired this tick
+            // (power-up wrappers let go now: DeathSystem may recycle those entities below)
+            expirySystem->update(dt);
+            powerUpSystem->onExpired(expirySystem->getExpired());
 
             Utils::Profiler::start("CollisionSystem");
             collisionSystem->update(dt);
             Utils::Profiler::stop("CollisionSystem");
 
+            // Apply this frame's damage in one pass (health, then damage/death callbacks)
+            damageSystem->resolve();
+            deathSystem->process(damageSystem->getDeaths());
+
+            // Weapons aim through this tick's collision broadphase (targets killed
+            // above are filtered out); new bullets are swept from their muzzle next tick
+            Utils::Profiler::start("WeaponSystem");
+            weaponSystem->update(dt);
+            Utils::Profiler::stop("WeaponSystem");
+
             Utils::Profiler::start("SpawnSystem");
             spawnSystem->update(dt);
             Utils::Profiler::stop("SpawnSystem");
@@ -261,24 +350,6 @@ namespace MediocreBONK::States
             // Process queued events
             Managers::EventManager::getInstance().processEvents();
 
-            // Performance monitoring (every 5 seconds)
-            static float perfTimer = 0.f;
-            perfTimer += dt.asSeconds();
-            if (perfTimer >= 5.f)
-            {
-                perfTimer = 0.f;
-                size_t totalEntities = entityManager->getTotalEntityCount();
-                size_t activeEntities = entityManager->getEntityCount();
-                auto enemies = entityManager->getEntitiesByTag("Enemy");
-                auto projectiles = entityManager->getEntitiesWithComponent<ECS::Components::Projectile>();
-                Utils::Logger::info("Performance: Total=" + std::to_string(totalEntities) +
-                                   " Active=" + std::to_string(activeEntities) +
-                                   " Enemies=" + std::to_string(enemies.size()) +
-                                   " Projectiles=" + std::to_string(projectiles.size()));
-                
-                Utils::Profiler::logResults();
-            }
-
             // Update HUD
             hud->update(dt);
 
@@ -350,30 +421,19 @@ namespace MediocreBONK::States
                 }
             }
 
-            // Draw projectiles
-            auto projectiles = entityManager->getEntitiesWithComponent<ECS::Components::Projectile>();
+            // Draw projectiles (one vertex batch)
+            size_t projectileCount = bulletSystem->size();
 
             static bool loggedProjectileCount = false;
-            static int lastProjectileCount = 0;
-            if (!loggedProjectileCount || projectiles.size() != lastProjectileCount)
+            static size_t lastProjectileCount = 0;
+            if (!loggedProjectileCount || projectileCount != lastProjectileCount)
             {
-                Utils::Logger::info("Rendering " + std::to_string(projectiles.size()) + " projectiles");
-                lastProjectileCount = projectiles.size();
+                Utils::Logger::info("Rendering " + std::to_string(projectileCount) + " projectiles");
+                lastProjectileCount = projectileCount;
                 loggedProjectileCount = true;
             }
 
-            for (auto* proj : projectiles)
-            {
-                auto* transform = proj->getComponent<ECS::Components::Transform>();
-                if (transform)
-                {
-                    sf::CircleShape projShape(5.f);
-                    projShape.setOrigin({5.f, 5.f});
-                    projShape.setPosition(transform->position);
-                    projShape.setFillColor(sf::Color::Yellow);
-                    window.draw(projShape);
-                }
-            }
+            bulletSystem->render(window);
 
             // Draw XP gems
             auto xpGems = entityManager->getEntitiesByTag("XPGem");
@@ -453,6 +513,14 @@ namespace MediocreBONK::States
                         player->dash();
                 }
 
+                // Debug: select broadphase backend (compare timings in profiler output)
+                if (keyPressed->code == sf::Keyboard::Key::F1)
+                    collisionSystem->setBroadphase(Utils::BroadphaseType::UniformGrid);
+                else if (keyPressed->code == sf::Keyboard::Key::F2)
+                    collisionSystem->setBroadphase(Utils::BroadphaseType::SweepAndPrune);
+                else if (keyPressed->code == sf::Keyboard::Key::F3)
+                    collisionSystem->setBroadphase(Utils::BroadphaseType::LooseQuadtree);
+
                 // Return to menu
                 if (keyPressed->code == sf::Keyboard::Key::Escape)
                 {
@@ -464,14 +532,40 @@ namespace MediocreBONK::States
     private:
         void transitionToDeathState(float survivalTime, int killCount, int level);
 
+        // Performance monitoring (scheduler job, every 5 seconds)
+        void logPerformance()
+        {
+            size_t totalEntities = entityManager->getTotalEntityCount();
+            size_t activeEntities = entityManager->getEntityCount();
+            auto enemies = entityManager->getEntitiesByTag("Enemy");
+            Utils::Logger::info("Performance: Total=" + std::to_string(totalEntities) +
+                               " Active=" + std::to_string(activeEntities) +
+                               " Enemies=" + std::to_string(enemies.size()) +
+                               " EnemyWrappers=" + std::to_string(spawnSystem->getLiveEnemyCount()) +
+                               "/" + std::to_string(spawnSystem->getPooledEnemyCount()) +
+                               " Projectiles=" + std::to_string(bulletSystem->size()) +
+                               " Dormant=" + std::to_string(dormancySystem->getDormantCount()) +
+                               " SchedulerPeak=" + std::to_string(scheduler->getPeakLoad()));
+
+            Utils::Profiler::logResults();
+        }
+
         std::unique_ptr<ECS::EntityManager> entityManager;
+        std::unique_ptr<Systems::BulletSystem> bulletSystem;
+        std::unique_ptr<Systems::DamageSystem> damageSystem;
         std::unique_ptr<Systems::WeaponSystem> weaponSystem;
         std::unique_ptr<Systems::CollisionSystem> collisionSystem;
         std::unique_ptr<Systems::SpawnSystem> spawnSystem;
         std::unique_ptr<Systems::XPSystem> xpSystem;
         std::unique_ptr<Systems::PowerUpSystem> powerUpSystem;
         std::unique_ptr<Systems::ParticleSystem> particleSystem;
+        std::unique_ptr<Systems::DeathSystem> deathSystem;
+        std::unique_ptr<Systems::ExpirySystem> expirySystem;
+        std::unique_ptr<Utils::FrameScheduler> scheduler;
         std::unique_ptr<Systems::WorldGenerator> worldGenerator;
+        std::unique_ptr<Systems::PathingSystem> pathingSystem;
+        std::unique_ptr<Systems::AISystem> aiSystem;
+        std::unique_ptr<Systems::DormancySystem> dormancySystem;
         std::unique_ptr<UI::HUD> hud;
         std::unique_ptr<UI::LevelUpMenu> levelUpMenu;
         std::unique_ptr<UI::NotificationManager> notificationManager;
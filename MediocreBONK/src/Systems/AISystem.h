@@ -0,0 +1,185 @@
+#pragma once
+#include "../ECS/EntityManager.h"
+#include "../ECS/Components/Transform.h"
+#include "../ECS/Components/AI.h"
+#include "../Utils/Math.h"
+#include "../Utils/Profiler.h"
+#include "../Utils/SteeringKernels.h"
+#include <SFML/System/Time.hpp>
+#include <array>
+#include <vector>
+#include <cstdint>
+
+namespace MediocreBONK::Systems
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: AI LEVEL OF DETAIL + TIME SLICING
+     *
+     * Problem:
+     * - AI::update ran its full logic (target lookup, range check, flow field
+     *   lookup, normalize) every tick for every enemy, including the ones far
+     *   off-screen that only drift toward the player
+     *
+     * Solution: Split AI into think() (decide) and act() (apply), think less
+     * when nobody is looking
+     * - Tier by squared distance to the camera center:
+     *   - Near (on screen + margin): think every tick
+     *   - Mid (up to MidRangeScale x the view): think every MidPeriod ticks
+     *   - Far (beyond): every FarPeriod ticks, straight line (no flow field)
+     * - Round-robin buckets: an enemy thinks when tick % period == id % period,
+     *   so each tick handles 1/period of every tier (no spike when many
+     *   enemies share a tier)
+     * - act() runs every tick for everyone: the last decision keeps being
+     *   applied (same movement physics, only the decision is older)
+     *
+     * Think cost per tick ~ near + mid / MidPeriod + far / FarPeriod
+     *
+     * BEHAVIOUR BUCKETS (see Utils::SteeringKernels)
+     * - Enemies due this tick are gathered into one SoA batch per behaviour
+     *   (flow field lookups happen while gathering)
+     * - One vectorisable kernel per batch, decisions written back to each AI
+     * - Idle and dormant enemies are never gathered (dormant ones don't act either)
+     */
+    class AISystem
+    {
+    public:
+        static constexpr uint32_t MidPeriod = 4;
+        static constexpr uint32_t FarPeriod = 16;
+        static constexpr float NearMargin = 150.f;   // Pixels beyond the view corner
+        static constexpr float MidRangeScale = 2.f;  // Times the view half-diagonal
+
+        AISystem(ECS::EntityManager* entityManager)
+            : entityManager(entityManager)
+            , currentTick(0)
+            , viewCenter(0.f, 0.f)
+            , nearRadius(0.f)
+            , midRadius(0.f)
+        {}
+
+        // Camera the tiers are measured from (call before update)
+        void setView(const sf::Vector2f& center, float halfDiagonal)
+        {
+            viewCenter = center;
+            nearRadius = halfDiagonal + NearMargin;
+            midRadius = halfDiagonal * MidRangeScale;
+        }
+
+        void update(sf::Time dt)
+        {
+            Utils::Profiler::start("AI");
+            for (size_t b = 0; b < BehaviorCount; ++b)
+            {
+                batches[b].clear();
+                owners[b].clear();
+            }
+
+            // 1. Gather: who thinks this tick, into the batch of its behaviour
+            auto aiEntities = entityManager->getEntitiesWithComponent<ECS::Components::AI>();
+            for (auto* entity : aiEntities)
+            {
+                auto* ai = entity->getComponent<ECS::Components::AI>();
+                auto* transform = entity->getComponent<ECS::Components::Transform>();
+                ai->systemDriven = true;
+
+                if (!transform || entity->isDormant() || ai->behavior == ECS::Components::AIBehavior::Idle)
+                    continue;
+
+                Tier tier = getTier(transform->position);
+                if (!isDue(entity->getId(), tier))
+                    continue;
+
+                if (!ai->updateTargetPosition())
+                {
+                    ai->setSteering(Utils::SteeringMode::None, sf::Vector2f(0.f, 0.f));
+                    continue;
+                }
+
+                size_t bucket = static_cast<size_t>(ai->behavior);
+                sf::Vector2f flow = ai->behavior == ECS::Components::AIBehavior::ChasePlayer
+                    ? ai->sampleFlow(transform->position, tier != Tier::Far)
+                    : sf::Vector2f(0.f, 0.f);
+                float parameter = ai->behavior == ECS::Components::AIBehavior::Circle ? ai->orbitRadius : ai->preferredRange;
+
+                batches[bucket].add(transform->position, ai->getTargetPosition(), ai->detectionRange,
+                                    ai->attackRange, flow, parameter, ai->orbitDirection);
+                owners[bucket].push_back(ai);
+            }
+
+            // 2. One kernel per behaviour
+            Utils::SteeringKernels::chase(batch(ECS::Components::AIBehavior::ChasePlayer));
+            Utils::SteeringKernels::flee(batch(ECS::Components::AIBehavior::Flee));
+            Utils::SteeringKernels::ranged(batch(ECS::Components::AIBehavior::Ranged));
+            Utils::SteeringKernels::circle(batch(ECS::Components::AIBehavior::Circle));
+
+            // 3. Write decisions back
+            size_t thinks = 0;
+            for (size_t b = 0; b < BehaviorCount; ++b)
+            {
+                const auto& results = batches[b];
+                for (size_t i = 0; i < owners[b].size(); ++i)
+                    owners[b][i]->setSteering(results.mode[i], sf::Vector2f(results.dirX[i], results.dirY[i]));
+                thinks += owners[b].size();
+            }
+
+            // 4. Everyone applies their latest decision
+            for (auto* entity : aiEntities)
+            {
+                if (!entity->isDormant())
+                    entity->getComponent<ECS::Components::AI>()->act();
+            }
+
+            ++currentTick;
+            Utils::Profiler::record("AI Thinks", static_cast<long long>(thinks));
+            Utils::Profiler::stop("AI");
+        }
+
+    private:
+        enum class Tier
+        {
+            Near,
+            Mid,
+            Far
+        };
+
+        Tier getTier(const sf::Vector2f& position) const
+        {
+            float distanceSquared = Utils::Math::distanceSquared(position, viewCenter);
+            if (distanceSquared <= nearRadius * nearRadius)
+                return Tier::Near;
+            if (distanceSquared <= midRadius * midRadius)
+                return Tier::Mid;
+            return Tier::Far;
+        }
+
+        // Round-robin bucket of this entity in its tier
+        bool isDue(uint64_t id, Tier tier) const
+        {
+            switch (tier)
+            {
+            case Tier::Near:
+                return true;
+            case Tier::Mid:
+                return currentTick % MidPeriod == id % MidPeriod;
+            default:
+                return currentTick % FarPeriod == id % FarPeriod;
+            }
+        }
+
+        Utils::SteeringBatch& batch(ECS::Components::AIBehavior behavior)
+        {
+            return batches[static_cast<size_t>(behavior)];
+        }
+
+        static constexpr size_t BehaviorCount = static_cast<size_t>(ECS::Components::AIBehavior::Idle) + 1;
+
+        ECS::EntityManager* entityManager;
+        uint64_t currentTick;
+        sf::Vector2f viewCenter;
+        float nearRadius;
+        float midRadius;
+
+        // Per behaviour (index = AIBehavior), reused every tick
+        std::array<Utils::SteeringBatch, BehaviorCount> batches;
+        std::array<std::vector<ECS::Components::AI*>, BehaviorCount> owners;
+    };
+}
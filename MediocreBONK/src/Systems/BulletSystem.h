@@ -0,0 +1,339 @@
+#pragma once
+#include "../ECS/Components/Collider.h"
+#include "../Utils/Math.h"
+#include "../Utils/Profiler.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+
+namespace MediocreBONK::Systems
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: SoA BULLET ENGINE (projectiles outside the ECS)
+     *
+     * Problem:
+     * - Every projectile was a full Entity: Transform + Physics + Projectile +
+     *   Collider = 4 heap components, a std::string owner tag, a heap hit list
+     *   and a component hash map, all for "a dot that moves in a straight line"
+     * - Late game fires thousands of them: allocation, virtual update() calls
+     *   and one draw call per bullet dominated the frame
+     *
+     * Solution: One flat store, Structure of Arrays
+     *   posX[] posY[] prevX[] prevY[] velX[] velY[] lifetime[] damage[] ...
+     * - Spawning = push_back into reserved arrays (no allocation, no entity);
+     *   spawnVolley() appends a whole weapon volley in one call
+     * - update(): one tight integrate loop over contiguous floats
+     *   (auto-vectorised: 4-8 bullets per instruction)
+     * - Collision: CollisionSystem sweeps prev -> pos of every bullet against
+     *   its broadphase (continuous collision, see CollisionSystem)
+     * - Hit set: a few entity ids stored INLINE per bullet (no heap), the
+     *   oldest is overwritten when full (a bullet never re-meets an enemy it
+     *   passed that many hits ago in practice)
+     * - Dead bullets are swap-removed: arrays stay dense
+     * - Rendering: all visible bullets in ONE vertex batch, one draw call
+     *
+     * Bullet order is not stable (swap-remove); nothing depends on it.
+     */
+    class BulletSystem
+    {
+    public:
+        static constexpr size_t MaxTrackedHits = 8;
+
+        // Entities already damaged by one bullet (fixed size, lives inline in the store)
+        struct HitSet
+        {
+            std::array<uint64_t, MaxTrackedHits> ids{};
+            uint8_t count = 0;
+            uint8_t next = 0; // Slot overwritten next once full (oldest)
+
+            bool contains(uint64_t id) const
+            {
+                for (uint8_t i = 0; i < count; ++i)
+                {
+                    if (ids[i] == id)
+                        return true;
+                }
+                return false;
+            }
+
+            void insert(uint64_t id)
+            {
+                if (count < MaxTrackedHits)
+                {
+                    ids[count++] = id;
+                    return;
+                }
+                ids[next] = id;
+                next = static_cast<uint8_t>((next + 1) % MaxTrackedHits);
+            }
+        };
+
+        BulletSystem(size_t capacity = 8192)
+            : capacity(capacity)
+        {
+            posX.reserve(capacity);
+            posY.reserve(capacity);
+            prevX.reserve(capacity);
+            prevY.reserve(capacity);
+            velX.reserve(capacity);
+            velY.reserve(capacity);
+            lifetime.reserve(capacity);
+            damage.reserve(capacity);
+            radius.reserve(capacity);
+            piercing.reserve(capacity);
+            layer.reserve(capacity);
+            alive.reserve(capacity);
+            hits.reserve(capacity);
+        }
+
+        // Returns false when the store is full (bullet dropped)
+        bool spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, float bulletDamage,
+                   int bulletPiercing, float bulletLifetime, float bulletRadius,
+                   ECS::Components::CollisionLayer bulletLayer)
+        {
+            if (posX.size() >= capacity)
+                return false;
+
+            // First sweep covers the spawn point only (prev = pos)
+            posX.push_back(position.x);
+            posY.push_back(position.y);
+            prevX.push_back(position.x);
+            prevY.push_back(position.y);
+            velX.push_back(velocity.x);
+            velY.push_back(velocity.y);
+            lifetime.push_back(bulletLifetime);
+            damage.push_back(bulletDamage);
+            radius.push_back(bulletRadius);
+            piercing.push_back(bulletPiercing);
+            layer.push_back(static_cast<uint8_t>(bulletLayer));
+            alive.push_back(1);
+            hits.push_back({});
+            return true;
+        }
+
+        // BATCHED EMISSION: one bullet per direction, all with the same stats
+        // Directions are unit vectors rotated by 'rotation' (unit vector, e.g. the aim)
+        // Returns how many bullets were created (the store may fill up)
+        size_t spawnVolley(const sf::Vector2f& origin, const sf::Vector2f* directions, size_t count,
+                           const sf::Vector2f& rotation, float speed, float bulletDamage, int bulletPiercing,
+                           float bulletLifetime, float bulletRadius, ECS::Components::CollisionLayer bulletLayer)
+        {
+            size_t first = posX.size();
+            count = std::min(count, capacity - std::min(capacity, first));
+            if (count == 0)
+                return 0;
+
+            size_t last = first + count;
+            posX.resize(last, origin.x);
+            posY.resize(last, origin.y);
+            prevX.resize(last, origin.x);
+            prevY.resize(last, origin.y);
+            lifetime.resize(last, bulletLifetime);
+            damage.resize(last, bulletDamage);
+            radius.resize(last, bulletRadius);
+            piercing.resize(last, bulletPiercing);
+            layer.resize(last, static_cast<uint8_t>(bulletLayer));
+            alive.resize(last, 1);
+            hits.resize(last);
+
+            velX.resize(last);
+            velY.resize(last);
+            for (size_t k = 0; k < count; ++k)
+            {
+                sf::Vector2f velocity = Utils::Math::rotate(directions[k], rotation) * speed;
+                velX[first + k] = velocity.x;
+                velY[first + k] = velocity.y;
+            }
+            return count;
+        }
+
+        // Integrate every bullet, drop expired ones
+        void update(sf::Time dt)
+        {
+            Utils::Profiler::start("Bullets Update");
+            float deltaSeconds = dt.asSeconds();
+            size_t count = posX.size();
+
+            // Straight-line motion, no drag: one pass per array keeps the loops vectorisable
+            for (size_t i = 0; i < count; ++i)
+            {
+                prevX[i] = posX[i];
+                prevY[i] = posY[i];
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                posX[i] += velX[i] * deltaSeconds;
+                posY[i] += velY[i] * deltaSeconds;
+                lifetime[i] -= deltaSeconds;
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (lifetime[i] <= 0.f)
+                    alive[i] = 0;
+            }
+
+            removeDead();
+            Utils::Profiler::stop("Bullets Update");
+            Utils::Profiler::record("Bullets", static_cast<long long>(posX.size()));
+        }
+
+        // COLLISION INTERFACE (CollisionSystem): this tick's move is getSweepStart(i) -> getPosition(i)
+        size_t size() const { return posX.size(); }
+        size_t getCapacity() const { return capacity; }
+
+        sf::Vector2f getPosition(size_t i) const { return { posX[i], posY[i] }; }
+        sf::Vector2f getSweepStart(size_t i) const { return { prevX[i], prevY[i] }; }
+        float getRadius(size_t i) const { return radius[i]; }
+        float getDamage(size_t i) const { return damage[i]; }
+        uint32_t getLayerIndex(size_t i) const { return layer[i]; }
+
+        bool isAlive(size_t i) const { return alive[i] != 0; }
+        bool canHit(size_t i, uint64_t entityId) const { return !hits[i].contains(entityId); }
+
+        // Remember the target, use up one pierce (dies at 0)
+        void recordHit(size_t i, uint64_t entityId)
+        {
+            hits[i].insert(entityId);
+            if (--piercing[i] <= 0)
+                alive[i] = 0;
+        }
+
+        // Marked only: indices stay valid until removeDead()
+        void kill(size_t i) { alive[i] = 0; }
+
+        // Swap-remove every killed bullet (invalidates indices)
+        void removeDead()
+        {
+            size_t i = 0;
+            while (i < posX.size())
+            {
+                if (alive[i])
+                {
+                    ++i;
+                    continue;
+                }
+
+                size_t last = posX.size() - 1;
+                if (i != last)
+                    moveBullet(last, i);
+                popBullet();
+            }
+        }
+
+        void clear()
+        {
+            posX.clear();
+            posY.clear();
+            prevX.clear();
+            prevY.clear();
+            velX.clear();
+            velY.clear();
+            lifetime.clear();
+            damage.clear();
+            radius.clear();
+            piercing.clear();
+            layer.clear();
+            alive.clear();
+            hits.clear();
+        }
+
+        // BATCHED RENDERING: visible bullets as small hexagons, one draw call
+        void render(sf::RenderWindow& window)
+        {
+            static constexpr int Sides = 6;
+            static const std::array<sf::Vector2f, Sides + 1> corners = [] {
+                std::array<sf::Vector2f, Sides + 1> result{};
+                for (int s = 0; s <= Sides; ++s)
+                {
+                    float angle = s * 2.f * 3.14159265f / Sides;
+                    result[s] = { std::cos(angle), std::sin(angle) };
+                }
+                return result;
+            }();
+
+            const sf::View& view = window.getView();
+            sf::Vector2f viewMin = view.getCenter() - view.getSize() / 2.f;
+            sf::Vector2f viewMax = view.getCenter() + view.getSize() / 2.f;
+            const uint8_t enemyLayer = static_cast<uint8_t>(ECS::Components::CollisionLayer::EnemyProjectile);
+
+            vertices.clear();
+            for (size_t i = 0; i < posX.size(); ++i)
+            {
+                float r = radius[i];
+                if (posX[i] + r < viewMin.x || posX[i] - r > viewMax.x ||
+                    posY[i] + r < viewMin.y || posY[i] - r > viewMax.y)
+                    continue;
+
+                sf::Vector2f center(posX[i], posY[i]);
+                sf::Color color = (layer[i] == enemyLayer) ? sf::Color(255, 120, 0) : sf::Color::Yellow;
+                for (int s = 0; s < Sides; ++s)
+                {
+                    vertices.push_back(sf::Vertex{ center, color });
+                    vertices.push_back(sf::Vertex{ center + corners[s] * r, color });
+                    vertices.push_back(sf::Vertex{ center + corners[s + 1] * r, color });
+                }
+            }
+
+            if (!vertices.empty())
+                window.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles);
+        }
+
+    private:
+        void moveBullet(size_t from, size_t to)
+        {
+            posX[to] = posX[from];
+            posY[to] = posY[from];
+            prevX[to] = prevX[from];
+            prevY[to] = prevY[from];
+            velX[to] = velX[from];
+            velY[to] = velY[from];
+            lifetime[to] = lifetime[from];
+            damage[to] = damage[from];
+            radius[to] = radius[from];
+            piercing[to] = piercing[from];
+            layer[to] = layer[from];
+            alive[to] = alive[from];
+            hits[to] = hits[from];
+        }
+
+        void popBullet()
+        {
+            posX.pop_back();
+            posY.pop_back();
+            prevX.pop_back();
+            prevY.pop_back();
+            velX.pop_back();
+            velY.pop_back();
+            lifetime.pop_back();
+            damage.pop_back();
+            radius.pop_back();
+            piercing.pop_back();
+            layer.pop_back();
+            alive.pop_back();
+            hits.pop_back();
+        }
+
+        size_t capacity;
+
+        // SoA: index i of every array is bullet i
+        std::vector<float> posX;
+        std::vector<float> posY;
+        std::vector<float> prevX;    // Position before this tick's move (sweep start)
+        std::vector<float> prevY;
+        std::vector<float> velX;
+        std::vector<float> velY;
+        std::vector<float> lifetime; // Seconds left
+        std::vector<float> damage;
+        std::vector<float> radius;
+        std::vector<int> piercing;   // Hits left
+        std::vector<uint8_t> layer;  // CollisionLayer index (PlayerProjectile / EnemyProjectile)
+        std::vector<uint8_t> alive;
+        std::vector<HitSet> hits;
+
+        // Render batch (reused every frame)
+        std::vector<sf::Vertex> vertices;
+    };
+}
@@ -3,28 +3,182 @@
 #include "../ECS/Components/Transform.h"
 #include "../ECS/Components/Collider.h"
 #include "../ECS/Components/Health.h"
-#include "../ECS/Components/Projectile.h"
-#include "../Utils/Math.h"
+#include "../ECS/Components/Sensor.h"
 #include "../Utils/Math.h"
 #include "../Utils/Logger.h"
-#include "../Utils/SpatialGrid.h"
+#include "../Utils/LayeredBroadphase.h"
+#include "../Utils/CollisionMatrix.h"
+#include "../Utils/CircleNarrowphase.h"
+#include "../Utils/ContactCache.h"
+#include "../Utils/SeparationSolver.h"
+#include "../Utils/ThreadPool.h"
+#include "WorldGenerator.h"
+#include "BulletSystem.h"
+#include "DamageSystem.h"
 #include "../Utils/Profiler.h"
 #include <SFML/System/Time.hpp>
 #include <vector>
+#include <array>
+#include <memory>
 #include <algorithm>
 
 namespace MediocreBONK::Systems
 {
+    /*
+     * OPTIMIZATION TECHNIQUE: SINGLE-PASS TYPED COLLISION PIPELINE
+     *
+     * Problem:
+     * - The old update ran four passes over the same colliders:
+     *   generic pairs, projectiles, player-enemy (brute force), enemy separation
+     * - Each pass did its own broadphase queries (~3N queries per frame)
+     *   and compared tag strings ("Enemy", "Player") for every candidate
+     *
+     * Solution: One broadphase traversal, classify once, dispatch by type
+     * 1. Build proxies (projectiles live in BulletSystem, see CONTINUOUS COLLISION below)
+     * 2. findPairs() once - every overlapping AABB pair, each pair once
+     * 3. Classify pair by (layerA, layerB) with a small lookup table
+     *    (Collider::layer bits, no strings), orient it (projectile first, player first...)
+     * 4. Narrowphase all circle pairs in one SIMD batch (CircleNarrowphase)
+     * 5. Hand each contact list to its handler:
+     *    - PlayerEnemy:   contact damage
+     *    - PlayerPickup:  collider callbacks (PowerUp collection)
+     *
+     * CONTINUOUS COLLISION (projectiles):
+     * - Problem: a projectile moves velocity * dt per tick and was only tested at
+     *   its end position. Once a step is longer than an enemy's diameter
+     *   (speed upgrades, or a lower tick rate under load) it tunnels through.
+     * - Projectiles are not entities and not in the broadphase: each BulletSystem
+     *   bullet sweeps its radius along this tick's move (getSweepStart() -> getPosition())
+     *   through the target layers of its ProjectileHit rules:
+     *   querySegment (grid: DDA over the cells along the segment), then an exact
+     *   swept-circle time of impact (Math::sweepCircle)
+     * - Hits are sorted by time of impact, so a piercing projectile damages
+     *   the enemies in the order it reaches them and stops at the right one
+     * - Hits no longer depend on step length: correct at any speed or tick rate
+     * - Far-away projectiles (cullingRange) are not swept at all
+     *
+     * STATIC WORLD (rocks, walls from WorldGenerator):
+     * - Never inserted in the per-frame broadphase: each world tile keeps its
+     *   own StaticAABBTree, built once when the tile is generated
+     * - Player and enemies are pushed out of obstacles (after separation)
+     * - Projectile sweeps also sweep the obstacles: hits behind the first
+     *   obstacle are dropped and the bullet is killed there
+     * - Static-vs-static pairs are never tested
+     *
+     * SENSORS AND TRIGGERS (overlap-only):
+     * - Sensor components (magnet radius...) are not proxies: after the build,
+     *   each sensor runs ONE layer-masked query against this tick's broadphase
+     *   and receives its overlaps as a batch (Sensor::getOverlaps / onOverlaps)
+     * - Trigger colliders (Collider::isTrigger: gems, power-ups) stay in the
+     *   broadphase for events and sensors, but get no response: no
+     *   separation, no static push-out
+     *
+     * Targeting reuses the same broadphase: findNearest() = layer-masked
+     * nearest / k-nearest query (WeaponSystem, after this tick's update).
+     *
+     * Dormant entities (Entity::isDormant, see DormancySystem) get no proxy:
+     * no pairs, no sensor overlaps, no separation, no static push-out.
+     *
+     * Enemy-enemy separation does not use pairs at all: the enemy layer does not
+     * collide with itself in the matrix, SeparationSolver bins enemies on its own
+     * and resolves overlaps with parallel Jacobi iterations.
+     *
+     * MULTITHREADING (broadphase + narrowphase only):
+     * - Cross-layer pair search: the LayeredBroadphase hands spatial regions of
+     *   queries to ThreadPool workers, each region fills its own pair buffer
+     * - Classification + circle tests: chunks of pairs, per-thread SIMD batches,
+     *   per-chunk contact buffers
+     * - Projectile sweeps + pierce counters: chunks of bullets (each chunk owns
+     *   its bullets), per-chunk damage buffers
+     * - Buffers are merged in region/chunk order -> same contacts in the same
+     *   order for 1 or 8 threads (replays and bug reports stay reproducible)
+     * - Damage is never applied here: DamageEvents go to DamageSystem, which
+     *   reduces and applies them after collision (health, death callbacks)
+     * - Collider callbacks and the contact cache stay serial on the main thread
+     *
+     * Collider callbacks go through a persistent ContactCache: onCollisionEnter
+     * fires once when a contact starts, onCollisionStay while it lasts and
+     * onCollisionExit once when it ends.
+     *
+     * Layer pairs without a handler (e.g. projectile-projectile, gem-enemy) are
+     * switched off in the CollisionMatrix, so the LayeredBroadphase never even
+     * generates them. Default-layer colliders still meet everything.
+     */
     class CollisionSystem
     {
     public:
+        // Kind of contact, decides which handler receives it
+        enum class ContactType : uint8_t
+        {
+            None,           // No handler, only collider callbacks (if any)
+            ProjectileHit,  // Projectile vs target layer (continuous sweep, not a pair contact)
+            PlayerEnemy,    // a = player, b = enemy
+            PlayerPickup,   // a = player, b = pickup
+            Count
+        };
+
         CollisionSystem(ECS::EntityManager* entityManager)
             : entityManager(entityManager)
             , playerDamageCooldown(0.f)
             , playerDamageInterval(0.5f) // Player can take damage every 0.5 seconds
             , cullingRange(1400.f) // Collision check range (must exceed spawn radius ~1151px)
-            , grid(100.f) // Cell size 100
-        {}
+            , broadphase(std::make_unique<Utils::LayeredBroadphase>(Utils::BroadphaseType::UniformGrid, &collisionMatrix))
+        {
+            using Layer = ECS::Components::CollisionLayer;
+            addPairRule(Layer::PlayerProjectile, Layer::Enemy, ContactType::ProjectileHit);
+            addPairRule(Layer::EnemyProjectile, Layer::Player, ContactType::ProjectileHit);
+            addPairRule(Layer::Player, Layer::Enemy, ContactType::PlayerEnemy);
+            addPairRule(Layer::Player, Layer::Pickup, ContactType::PlayerPickup);
+
+            // Untagged colliders keep the old "collide with everything" behaviour
+            collisionMatrix.setAll(static_cast<uint32_t>(Layer::Default), true);
+        }
+
+        // Swap broadphase backend at runtime (takes effect next update)
+        void setBroadphase(Utils::BroadphaseType type)
+        {
+            if (type == broadphase->getType())
+                return;
+
+            broadphase = std::make_unique<Utils::LayeredBroadphase>(type, &collisionMatrix);
+            Utils::Logger::info(std::string("CollisionSystem: broadphase set to ") + broadphase->getName());
+        }
+
+        Utils::BroadphaseType getBroadphaseType() const { return broadphase->getType(); }
+        const Utils::Broadphase& getBroadphase() const { return *broadphase; }
+
+        // Enable/disable a layer pair in the broadphase (pairs without a handler only reach collider callbacks)
+        void setLayerCollision(ECS::Components::CollisionLayer a, ECS::Components::CollisionLayer b, bool collide)
+        {
+            collisionMatrix.set(static_cast<uint32_t>(a), static_cast<uint32_t>(b), collide);
+        }
+
+        const Utils::CollisionMatrix& getCollisionMatrix() const { return collisionMatrix; }
+
+        // Static obstacles (rocks/walls of the generated world tiles), nullptr = none
+        void setStaticWorld(const WorldGenerator* world) { staticWorld = world; }
+
+        // Projectile store swept against the broadphase, nullptr = no projectiles
+        void setBulletSystem(BulletSystem* bulletSystem) { bullets = bulletSystem; }
+
+        // Damage goes to this buffer (resolved by the owner after update), nullptr = apply immediately
+        void setDamageSystem(DamageSystem* system) { damageSystem = system; }
+
+        // Iteration count / relaxation of the enemy separation solver
+        Utils::SeparationSolver& getSeparationSolver() { return separationSolver; }
+
+        // NEAREST QUERY on this tick's broadphase: up to k active entities of
+        // 'layerMask' (Collider::layerBit) nearest to position, nearest first
+        // Call after update() and before the next EntityManager::update (its
+        // maintenance may free entities the proxies still point to)
+        void findNearest(const sf::Vector2f& position, size_t k, float maxDistance, uint32_t layerMask,
+                         std::vector<ECS::Entity*>& result)
+        {
+            result.clear();
+            broadphase->queryNearestLayers(position, k, maxDistance, layerMask, nearestScratch, isStillOnLayer);
+            for (const auto& neighbour : nearestScratch)
+                result.push_back(proxies[neighbour.index].entity);
+        }
 
         void update(sf::Time dt)
         {
@@ -32,84 +186,153 @@ namespace MediocreBONK::Systems
             if (playerDamageCooldown > 0.f)
                 playerDamageCooldown -= dt.asSeconds();
 
-            // Get all entities with colliders
-            auto colliders = entityManager->getEntitiesWithComponents<
-                ECS::Components::Transform,
-                ECS::Components::Collider
-            >();
+            buildProxies();
 
-            // Rebuild grid
-            Utils::Profiler::start("Grid Rebuild");
-            grid.clear();
-            for (auto* entity : colliders)
-            {
-                grid.insert(entity);
-            }
-            Utils::Profiler::stop("Grid Rebuild");
-
-            // Optimized collision detection using grid
+            // Broadphase collision detection: each overlapping pair reported once
             Utils::Profiler::start("Grid Collision");
-            for (auto* entityA : colliders)
-            {
-                auto* transformA = entityA->getComponent<ECS::Components::Transform>();
-                auto* colliderA = entityA->getComponent<ECS::Components::Collider>();
-
-                // Query nearby entities
-                // Search radius = collider radius + max expected other radius (e.g. 50)
-                float searchRadius = colliderA->radius + 50.f; 
-                auto nearby = grid.query(transformA->position, searchRadius);
-
-                for (auto* entityB : nearby)
-                {
-                    if (entityA == entityB) continue;
-                    
-                    // Avoid double checking
-                    if (entityA->getId() > entityB->getId()) continue;
-
-                    checkCollision(entityA, entityB);
-                }
-            }
+            pairs.clear();
+            broadphase->findPairs(pairs);
             Utils::Profiler::stop("Grid Collision");
 
-            // Handle projectile-entity collisions separately
-            handleProjectileCollisions();
+            // Classify + narrowphase: contacts end up bucketed by type
+            Utils::Profiler::start("Narrowphase");
+            classifyPairs();
+            Utils::Profiler::stop("Narrowphase");
+
+            // Continuous projectile collision: sweep + pierce per bullet, damage is only recorded
+            Utils::Profiler::start("Proj Collision");
+            sweepProjectiles();
+            Utils::Profiler::stop("Proj Collision");
 
-            // Handle player-enemy collisions (damage)
-            handlePlayerEnemyCollisions();
+            // Overlap-only sensors (magnet radius...) against this tick's broadphase
+            Utils::Profiler::start("Sensors");
+            updateSensors();
+            Utils::Profiler::stop("Sensors");
 
-            // Handle enemy-enemy separation
+            // Dispatch to per-type handlers
+            notifyCallbacks();
+            handlePlayerEnemyContacts(contactsOf(ContactType::PlayerEnemy));
             handleEnemySeparation();
+            handleStaticCollisions();
+
+            // Report per-frame broadphase measurements (averaged by Profiler::logResults)
+            const auto& stats = broadphase->getStats();
+            std::string name = broadphase->getName();
+            Utils::Profiler::record(name + " Pairs", static_cast<long long>(stats.pairCount));
+            Utils::Profiler::record(name + " Queries", static_cast<long long>(stats.queryCount));
+            Utils::Profiler::record(name + " Build (us)", stats.buildMicros);
+            Utils::Profiler::record(name + " Pair Search (us)", stats.pairMicros);
+            Utils::Profiler::record("Contacts Projectile", static_cast<long long>(projectileDamage.size()));
+            Utils::Profiler::record("Enemy Overlaps", static_cast<long long>(separationSolver.getOverlapCount()));
+            Utils::Profiler::record("Cached Contacts", static_cast<long long>(contactCache.size()));
+            Utils::Profiler::record("Sensor Overlaps", static_cast<long long>(sensorOverlapCount));
         }
 
     private:
-        void checkCollision(ECS::Entity* a, ECS::Entity* b)
+        // Components behind each proxy (same index), saves getComponent() lookups
+        struct Body
         {
-            auto* transformA = a->getComponent<ECS::Components::Transform>();
-            auto* transformB = b->getComponent<ECS::Components::Transform>();
-            auto* colliderA = a->getComponent<ECS::Components::Collider>();
-            auto* colliderB = b->getComponent<ECS::Components::Collider>();
+            ECS::Components::Transform* transform;
+            ECS::Components::Collider* collider;
+            uint32_t layerIndex;
+        };
 
-            if (colliderA->intersects(colliderB, transformA->position, transformB->position))
+        // Dispatch table entry for a (layerA, layerB) pair
+        struct PairRule
+        {
+            ContactType type = ContactType::None;
+            bool swap = false; // true: proxy b plays role 'a' for the handler
+        };
+
+        // Projectile hit found by the sweep (time = 0..1 along the move)
+        struct SweptHit
+        {
+            uint32_t projectile; // Bullet index in BulletSystem
+            uint32_t target;     // Index into proxies, or BlockedByObstacle
+            float time;
+        };
+
+        // SweptHit::target of the obstacle that stops a projectile (always its last hit)
+        static constexpr uint32_t BlockedByObstacle = 0xFFFFFFFF;
+
+        // Per-thread sweep buffers (indexed by ThreadPool worker index)
+        struct SweepScratch
+        {
+            std::vector<uint32_t> candidates;
+            std::vector<SweptHit> hits; // One bullet's hits, time order
+        };
+
+        // Narrowphase result before bucketing
+        struct TypedContact
+        {
+            Utils::BroadphasePair pair;
+            ContactType type;
+        };
+
+        // Per-thread narrowphase scratch (indexed by ThreadPool worker index)
+        struct ClassifyScratch
+        {
+            struct Candidate
             {
-                // Trigger callbacks if they exist
-                if (colliderA->onCollisionEnter)
-                    colliderA->onCollisionEnter(b);
+                TypedContact contact;
+                uint32_t batchIndex; // Slot in 'batch', or NoBatch if already tested
+            };
 
-                if (colliderB->onCollisionEnter)
-                    colliderB->onCollisionEnter(a);
+            Utils::CirclePairBatch batch;
+            std::vector<Candidate> candidates;
+            std::vector<uint32_t> hits;
+            std::vector<uint8_t> hitFlags;
+        };
+
+        static constexpr size_t LayerCount = static_cast<size_t>(ECS::Components::CollisionLayer::Count);
+        static constexpr size_t ContactTypeCount = static_cast<size_t>(ContactType::Count);
+
+        void addPairRule(ECS::Components::CollisionLayer first, ECS::Components::CollisionLayer second, ContactType type)
+        {
+            size_t a = static_cast<size_t>(first);
+            size_t b = static_cast<size_t>(second);
+            pairRules[a][b] = { type, false };
+            pairRules[b][a] = { type, a != b };
+            collisionMatrix.set(static_cast<uint32_t>(a), static_cast<uint32_t>(b), true);
+        }
+
+        // Lowest set layer bit -> layer index (unknown layers fall back to Default)
+        // Proxy still describes its entity: not killed since the build, and not
+        // recycled into something else (createEntity() at the entity cap
+        // re-adds components). Looked up through the entity, never cached pointers
+        static bool isStillOnLayer(const Utils::BroadphaseProxy& proxy)
+        {
+            if (!proxy.entity->isActive())
+                return false;
+            auto* collider = proxy.entity->getComponent<ECS::Components::Collider>();
+            return collider && toLayerIndex(collider->layer) == proxy.layer;
+        }
+
+        static uint32_t toLayerIndex(uint32_t layerBits)
+        {
+            for (uint32_t i = 0; i < LayerCount; ++i)
+            {
+                if (layerBits & (1u << i))
+                    return i;
             }
+            return static_cast<uint32_t>(ECS::Components::CollisionLayer::Default);
         }
 
-        void handleProjectileCollisions()
+        std::vector<Utils::BroadphasePair>& contactsOf(ContactType type)
         {
-            auto projectiles = entityManager->getEntitiesWithComponents<
+            return contacts[static_cast<size_t>(type)];
+        }
+
+        // Snapshot colliders into flat proxy array, rebuild broadphase
+        void buildProxies()
+        {
+            auto colliders = entityManager->getEntitiesWithComponents<
                 ECS::Components::Transform,
-                ECS::Components::Projectile,
                 ECS::Components::Collider
             >();
 
             // Get player position for culling
-            auto players = entityManager->getEntitiesByTag("Player");
+            auto& players = entityManager->getEntitiesByTag("Player");
             sf::Vector2f playerPos(0.f, 0.f);
             if (!players.empty())
             {
@@ -118,171 +341,522 @@ namespace MediocreBONK::Systems
                     playerPos = pTransform->position;
             }
 
-            Utils::Profiler::start("Proj Collision");
-            for (auto* projectile : projectiles)
+            Utils::Profiler::start("Broadphase Build");
+            proxies.clear();
+            bodies.clear();
+            for (auto* entity : colliders)
+            {
+                // Dormant entities are not in the broadphase (woken by DormancySystem)
+                if (entity->isDormant())
+                    continue;
+
+                auto* transform = entity->getComponent<ECS::Components::Transform>();
+                auto* collider = entity->getComponent<ECS::Components::Collider>();
+                uint32_t layerIndex = toLayerIndex(collider->layer);
+                proxies.push_back(makeProxy(entity, transform, collider, layerIndex));
+                bodies.push_back({ transform, collider, layerIndex });
+            }
+            broadphase->build(proxies);
+
+            // Bullets to sweep this tick (cull those too far from the player)
+            sweptBullets.clear();
+            if (bullets)
+            {
+                for (uint32_t i = 0; i < bullets->size(); ++i)
+                {
+                    if (Utils::Math::distanceSquared(bullets->getPosition(i), playerPos) <= cullingRange * cullingRange)
+                        sweptBullets.push_back(i);
+                }
+            }
+            Utils::Profiler::stop("Broadphase Build");
+        }
+
+        static Utils::BroadphaseProxy makeProxy(ECS::Entity* entity,
+                                                const ECS::Components::Transform* transform,
+                                                const ECS::Components::Collider* collider,
+                                                uint32_t layerIndex)
+        {
+            sf::FloatRect bounds = collider->getBounds(transform->position);
+
+            Utils::BroadphaseProxy proxy;
+            proxy.entity = entity;
+            proxy.position = transform->position;
+            proxy.radius = collider->radius;
+            proxy.minX = bounds.position.x;
+            proxy.minY = bounds.position.y;
+            proxy.maxX = bounds.position.x + bounds.size.x;
+            proxy.maxY = bounds.position.y + bounds.size.y;
+            proxy.layer = layerIndex;
+            return proxy;
+        }
+
+        // Same rule as Collider::intersects (either side may accept the other)
+        static bool layersMatch(const ECS::Components::Collider* a, const ECS::Components::Collider* b)
+        {
+            return (a->layer & b->mask) != 0 || (b->layer & a->mask) != 0;
+        }
+
+        static bool hasCallbacks(const ECS::Components::Collider* collider)
+        {
+            return collider->onCollisionEnter || collider->onCollisionStay || collider->onCollisionExit;
+        }
+
+        // Classify every broadphase pair once, narrowphase them, bucket contacts by type
+        // Runs in parallel over chunks of pairs; the merged contact list keeps pair order
+        void classifyPairs()
+        {
+            static constexpr size_t PairsPerTask = 256;
+
+            for (auto& list : contacts)
+                list.clear();
+            typedContacts.clear();
+
+            auto& pool = Utils::ThreadPool::getInstance();
+            classifyScratch.resize(pool.getThreadCount());
+
+            pool.parallelCollect(pairs.size(), PairsPerTask, chunkContacts, typedContacts,
+                [this](size_t begin, size_t end, size_t worker, std::vector<TypedContact>& out) {
+                    classifyRange(begin, end, classifyScratch[worker], out);
+                });
+
+            // Serial bucketing: handlers see contacts in broadphase pair order
+            for (const auto& contact : typedContacts)
+                contactsOf(contact.type).push_back(contact.pair);
+        }
+
+        // Reads bodies/proxies only, writes the worker's scratch and its chunk output
+        void classifyRange(size_t begin, size_t end, ClassifyScratch& scratch, std::vector<TypedContact>& out) const
+        {
+            static constexpr uint32_t NoBatch = 0xFFFFFFFF;
+
+            scratch.batch.clear();
+            scratch.candidates.clear();
+
+            for (size_t p = begin; p < end; ++p)
             {
-                auto* projComp = projectile->getComponent<ECS::Components::Projectile>();
-                auto* projTransform = projectile->getComponent<ECS::Components::Transform>();
-                auto* projCollider = projectile->getComponent<ECS::Components::Collider>();
+                const auto& pair = pairs[p];
+                const Body& a = bodies[pair.a];
+                const Body& b = bodies[pair.b];
 
-                // Cull projectiles too far from player
-                if (Utils::Math::distanceSquared(projTransform->position, playerPos) > cullingRange * cullingRange)
+                const PairRule& rule = pairRules[a.layerIndex][b.layerIndex];
+                if (rule.type == ContactType::None && !hasCallbacks(a.collider) && !hasCallbacks(b.collider))
                     continue;
 
-                // Get potential targets from grid
-                std::string targetTag = (projComp->getOwnerTag() == "Player") ? "Enemy" : "Player";
-                
-                // Query grid
-                float searchRadius = projCollider->radius + 50.f; // Assume max enemy radius 50
-                auto potentialTargets = grid.query(projTransform->position, searchRadius);
+                if (!layersMatch(a.collider, b.collider))
+                    continue;
+
+                Utils::BroadphasePair oriented = rule.swap ? Utils::BroadphasePair{ pair.b, pair.a } : pair;
 
-                for (auto* target : potentialTargets)
+                if (a.collider->shape == ECS::Components::ColliderShape::Circle &&
+                    b.collider->shape == ECS::Components::ColliderShape::Circle)
                 {
-                    if (target->tag != targetTag) continue;
+                    // Decided later by the SIMD batch
+                    scratch.candidates.push_back({ { oriented, rule.type }, static_cast<uint32_t>(scratch.batch.size()) });
+                    scratch.batch.add(proxies[pair.a].position, a.collider->radius,
+                                      proxies[pair.b].position, b.collider->radius);
+                }
+                else if (a.collider->intersects(b.collider, a.transform->position, b.transform->position))
+                {
+                    scratch.candidates.push_back({ { oriented, rule.type }, NoBatch });
+                }
+            }
 
-                    // Skip if already hit this target
-                    if (!projComp->canHit(target->getId()))
-                        continue;
+            scratch.hits.clear();
+            Utils::CircleNarrowphase::testPairs(scratch.batch, scratch.hits);
+            scratch.hitFlags.assign(scratch.batch.size(), 0);
+            for (uint32_t hit : scratch.hits)
+                scratch.hitFlags[hit] = 1;
 
-                    auto* targetTransform = target->getComponent<ECS::Components::Transform>();
-                    auto* targetCollider = target->getComponent<ECS::Components::Collider>();
-                    auto* targetHealth = target->getComponent<ECS::Components::Health>();
+            for (const auto& candidate : scratch.candidates)
+            {
+                if (candidate.batchIndex == NoBatch || scratch.hitFlags[candidate.batchIndex])
+                    out.push_back(candidate.contact);
+            }
+        }
 
-                    if (!targetTransform || !targetCollider || !targetHealth)
+        // Collider callbacks (PowerUp collection goes through here)
+        // Only contacts with a callback go through the contact cache,
+        // so Enter runs once per contact instead of once per frame
+        void notifyCallbacks()
+        {
+            contactCache.beginFrame();
+            for (const auto& list : contacts)
+            {
+                for (const auto& contact : list)
+                {
+                    auto* colliderA = bodies[contact.a].collider;
+                    auto* colliderB = bodies[contact.b].collider;
+                    if (!hasCallbacks(colliderA) && !hasCallbacks(colliderB))
                         continue;
 
-                    // Check collision
-                    if (projCollider->intersects(targetCollider, projTransform->position, targetTransform->position))
-                    {
-                        // Apply damage
-                        targetHealth->takeDamage(projComp->getDamage());
-
-                        // Record hit
-                        projComp->recordHit(target->getId());
+                    auto* entityA = proxies[contact.a].entity;
+                    auto* entityB = proxies[contact.b].entity;
+                    bool entered = contactCache.touch(entityA->getId(), entityB->getId());
 
-                        // Projectile might be deactivated by recordHit if piercing runs out
-                        if (!projectile->isActive())
-                            break;
+                    // Trigger callbacks if they exist
+                    if (entered)
+                    {
+                        if (colliderA->onCollisionEnter)
+                            colliderA->onCollisionEnter(entityB);
+                        if (colliderB->onCollisionEnter)
+                            colliderB->onCollisionEnter(entityA);
+                    }
+                    else
+                    {
+                        if (colliderA->onCollisionStay)
+                            colliderA->onCollisionStay(entityB);
+                        if (colliderB->onCollisionStay)
+                            colliderB->onCollisionStay(entityA);
                     }
                 }
             }
-            Utils::Profiler::stop("Proj Collision");
+            contactCache.endFrame();
+
+            // Contacts that ended (separated, or one side deactivated/cleaned up)
+            for (const auto& key : contactCache.getExited())
+            {
+                auto* entityA = entityManager->getEntity(key.a);
+                auto* entityB = entityManager->getEntity(key.b);
+                notifyExit(entityA, entityB);
+                notifyExit(entityB, entityA);
+            }
         }
 
+        static void notifyExit(ECS::Entity* self, ECS::Entity* other)
+        {
+            if (!self || !self->isActive())
+                return;
 
+            auto* collider = self->getComponent<ECS::Components::Collider>();
+            if (collider && collider->onCollisionExit)
+                collider->onCollisionExit(other); // other may be nullptr (already cleaned up)
+        }
 
-        void handlePlayerEnemyCollisions()
+        // Find every target each bullet touches along its move, in time order, and use up
+        // its piercing on them. Runs in parallel over chunks of bullets: a chunk only writes
+        // its own bullets and its own damage buffer (health is changed later, by DamageSystem)
+        void sweepProjectiles()
         {
-            // Only apply damage if cooldown has expired
-            if (playerDamageCooldown > 0.f)
+            static constexpr size_t ProjectilesPerTask = 64;
+
+            // Target layers per projectile layer: ProjectileHit rules the matrix allows
+            std::array<uint32_t, LayerCount> targetMasks{};
+            for (uint32_t layer = 0; layer < LayerCount; ++layer)
+            {
+                for (uint32_t target = 0; target < LayerCount; ++target)
+                {
+                    if (pairRules[layer][target].type == ContactType::ProjectileHit &&
+                        collisionMatrix.canCollide(layer, target))
+                        targetMasks[layer] |= 1u << target;
+                }
+            }
+
+            projectileDamage.clear();
+            if (!bullets)
                 return;
 
-            auto players = entityManager->getEntitiesByTag("Player");
-            auto enemies = entityManager->getEntitiesByTag("Enemy");
+            auto& pool = Utils::ThreadPool::getInstance();
+            sweepScratch.resize(pool.getThreadCount());
+
+            pool.parallelCollect(sweptBullets.size(), ProjectilesPerTask, chunkDamage, projectileDamage,
+                [&](size_t begin, size_t end, size_t worker, std::vector<DamageEvent>& out) {
+                    SweepScratch& scratch = sweepScratch[worker];
+                    for (size_t k = begin; k < end; ++k)
+                    {
+                        uint32_t bullet = sweptBullets[k];
+                        uint32_t mask = targetMasks[std::min<size_t>(bullets->getLayerIndex(bullet), LayerCount - 1)];
+                        if (mask == 0)
+                            continue;
+
+                        scratch.candidates.clear();
+                        scratch.hits.clear();
+                        sweepProjectile(bullet, mask, scratch.candidates, scratch.hits);
+                        applyProjectileHits(bullet, scratch.hits, out);
+                    }
+                });
 
-            for (auto* player : players)
+            broadphase->addQueryCount(sweptBullets.size());
+
+            // Dead bullets can go now: damage events hold entities, not bullet indices
+            bullets->removeDead();
+            for (const auto& event : projectileDamage)
+                dealDamage(event.target, event.amount, DamageSource::Projectile);
+        }
+
+        // Swept test of one bullet, appends its hits sorted by time of impact
+        void sweepProjectile(uint32_t index, uint32_t targetMask, std::vector<uint32_t>& candidates,
+                             std::vector<SweptHit>& out) const
+        {
+            sf::Vector2f start = bullets->getSweepStart(index);
+            sf::Vector2f end = bullets->getPosition(index);
+            float radius = bullets->getRadius(index);
+            sf::Vector2f delta = end - start;
+            broadphase->querySegmentLayersConcurrent(start, end, radius, targetMask, candidates);
+
+            size_t first = out.size();
+            for (uint32_t target : candidates)
             {
-                auto* playerTransform = player->getComponent<ECS::Components::Transform>();
-                auto* playerCollider = player->getComponent<ECS::Components::Collider>();
-                auto* playerHealth = player->getComponent<ECS::Components::Health>();
+                const Body& body = bodies[target];
+                float time = 1.f;
+                if (body.collider->shape == ECS::Components::ColliderShape::Circle)
+                {
+                    if (!Utils::Math::sweepCircle(start, delta, radius,
+                                                  proxies[target].position, body.collider->radius, time))
+                        continue;
+                }
+                else if (!circleTouchesBox(end, radius, proxies[target]))
+                {
+                    continue; // Non-circle targets: end position only
+                }
 
-                if (!playerTransform || !playerCollider || !playerHealth)
-                    continue;
+                out.push_back({ index, target, time });
+            }
+
+            std::sort(out.begin() + first, out.end(), [](const SweptHit& x, const SweptHit& y) {
+                return x.time != y.time ? x.time < y.time : x.target < y.target;
+            });
+
+            // Targets behind the first obstacle are never reached
+            float blockTime;
+            if (staticWorld && staticWorld->sweepObstacles(start, end, radius, blockTime))
+            {
+                auto behind = std::find_if(out.begin() + first, out.end(), [blockTime](const SweptHit& hit) {
+                    return hit.time > blockTime;
+                });
+                out.erase(behind, out.end());
+                out.push_back({ index, BlockedByObstacle, blockTime });
+            }
+        }
 
-                for (auto* enemy : enemies)
+        static bool circleTouchesBox(const sf::Vector2f& center, float radius, const Utils::BroadphaseProxy& box)
+        {
+            float closestX = Utils::Math::clamp(center.x, box.minX, box.maxX);
+            float closestY = Utils::Math::clamp(center.y, box.minY, box.maxY);
+            return Utils::Math::distanceSquared(center, { closestX, closestY }) < radius * radius;
+        }
+
+        // Hits of one bullet, nearest first: piercing runs out at the right target
+        void applyProjectileHits(uint32_t bullet, const std::vector<SweptHit>& hits, std::vector<DamageEvent>& out) const
+        {
+            for (const auto& hit : hits)
+            {
+                // Piercing ran out on an earlier hit
+                if (!bullets->isAlive(bullet))
+                    return;
+
+                // Stopped by a rock/wall
+                if (hit.target == BlockedByObstacle)
                 {
-                    auto* enemyTransform = enemy->getComponent<ECS::Components::Transform>();
-                    auto* enemyCollider = enemy->getComponent<ECS::Components::Collider>();
+                    bullets->kill(bullet);
+                    return;
+                }
 
-                    if (!enemyTransform || !enemyCollider)
-                        continue;
+                auto* target = proxies[hit.target].entity;
+                if (!target->getComponent<ECS::Components::Health>())
+                    continue;
 
-                    // Check collision
-                    if (playerCollider->intersects(enemyCollider, playerTransform->position, enemyTransform->position))
-                    {
-                        // Apply damage to player
-                        float enemyDamage = 5.f; // Default damage
-                        playerHealth->takeDamage(enemyDamage);
+                // Skip if already hit this target
+                if (!bullets->canHit(bullet, target->getId()))
+                    continue;
 
-                        // Reset cooldown so we don't apply damage again immediately
-                        playerDamageCooldown = playerDamageInterval;
+                bullets->recordHit(bullet, target->getId());
+                out.push_back({ target, target->getId(), bullets->getDamage(bullet), DamageSource::Projectile });
+            }
+        }
 
-                        // Only apply damage once per cooldown cycle, then return
-                        return;
-                    }
+        void dealDamage(ECS::Entity* target, float amount, DamageSource source)
+        {
+            if (damageSystem)
+                damageSystem->queue(target, amount, source);
+            else if (auto* health = target->getComponent<ECS::Components::Health>())
+                health->takeDamage(amount);
+        }
+
+        // One masked broadphase query per sensor, circle test against the collider radius
+        // Overlaps are stored first, callbacks run after: a callback may move or
+        // deactivate entities without affecting the other sensors of this tick
+        void updateSensors()
+        {
+            auto sensorEntities = entityManager->getEntitiesWithComponents<
+                ECS::Components::Transform,
+                ECS::Components::Sensor
+            >();
+
+            sensorOverlapCount = 0;
+            activeSensors.clear();
+            for (auto* entity : sensorEntities)
+            {
+                auto* sensor = entity->getComponent<ECS::Components::Sensor>();
+                sensor->overlaps.clear();
+                if (!sensor->enabled || sensor->detectMask == 0)
+                    continue;
+
+                const sf::Vector2f& center = entity->getComponent<ECS::Components::Transform>()->position;
+                sensorCandidates.clear();
+                broadphase->queryLayers(center, sensor->radius, sensor->detectMask, sensorCandidates);
+
+                for (uint32_t index : sensorCandidates)
+                {
+                    const Utils::BroadphaseProxy& proxy = proxies[index];
+                    if (proxy.entity == entity)
+                        continue;
+
+                    float distanceSquared = Utils::Math::distanceSquared(center, proxy.position);
+                    float reach = sensor->radius + proxy.radius;
+                    if (distanceSquared <= reach * reach)
+                        sensor->overlaps.push_back({ proxy.entity, distanceSquared });
                 }
+
+                sensorOverlapCount += sensor->overlaps.size();
+                if (sensor->onOverlaps && !sensor->overlaps.empty())
+                    activeSensors.push_back(sensor);
             }
+
+            for (auto* sensor : activeSensors)
+                sensor->onOverlaps(sensor->overlaps);
         }
 
-        void handleEnemySeparation()
+        void handlePlayerEnemyContacts(const std::vector<Utils::BroadphasePair>& contactList)
         {
-            auto enemies = entityManager->getEntitiesByTag("Enemy");
+            // Only apply damage if cooldown has expired
+            if (playerDamageCooldown > 0.f)
+                return;
+
+            for (const auto& contact : contactList)
+            {
+                auto* playerEntity = proxies[contact.a].entity;
+                if (!playerEntity->getComponent<ECS::Components::Health>())
+                    continue;
+
+                // Apply damage to player
+                float enemyDamage = 5.f; // Default damage
+                dealDamage(playerEntity, enemyDamage, DamageSource::Contact);
+
+                // Reset cooldown so we don't apply damage again immediately
+                playerDamageCooldown = playerDamageInterval;
+
+                // Only apply damage once per cooldown cycle, then return
+                return;
+            }
+        }
 
+        void handleEnemySeparation()
+        {
             // Enemy separation - push enemies apart if overlapping
             Utils::Profiler::start("Enemy Separation");
-            for (size_t i = 0; i < enemies.size(); ++i)
+            const uint32_t enemyLayer = static_cast<uint32_t>(ECS::Components::CollisionLayer::Enemy);
+
+            enemyTransforms.clear();
+            enemyPositions.clear();
+            enemyRadii.clear();
+            for (const Body& body : bodies)
             {
-                auto* enemyA = enemies[i];
-                auto* transformA = enemyA->getComponent<ECS::Components::Transform>();
-                auto* colliderA = enemyA->getComponent<ECS::Components::Collider>();
-                
-                if (!transformA || !colliderA) continue;
+                if (body.layerIndex != enemyLayer || body.collider->shape != ECS::Components::ColliderShape::Circle ||
+                    body.collider->isTrigger)
+                    continue;
 
-                // Query grid for neighbors
-                float searchRadius = colliderA->radius * 2.5f; // Look for overlapping enemies
-                auto neighbors = grid.query(transformA->position, searchRadius);
+                enemyTransforms.push_back(body.transform);
+                enemyPositions.push_back(body.transform->position);
+                enemyRadii.push_back(body.collider->radius);
+            }
 
-                for (auto* enemyB : neighbors)
-                {
-                    if (enemyA == enemyB) continue;
-                    // Only separate from other enemies
-                    if (enemyB->tag != "Enemy") continue;
-                    
-                    // Avoid double check
-                    if (enemyA->getId() > enemyB->getId()) continue;
+            separationSolver.solve(enemyPositions, enemyRadii);
 
-                    auto* transformB = enemyB->getComponent<ECS::Components::Transform>();
-                    auto* colliderB = enemyB->getComponent<ECS::Components::Collider>();
+            for (size_t i = 0; i < enemyTransforms.size(); ++i)
+                enemyTransforms[i]->position = enemyPositions[i];
+            Utils::Profiler::stop("Enemy Separation");
+        }
 
-                    if (!transformB || !colliderB) continue;
+        // Push player and enemies out of static obstacles
+        // Each body only moves its own transform -> parallel over bodies
+        void handleStaticCollisions()
+        {
+            if (!staticWorld)
+                return;
 
-                    if (colliderA->intersects(colliderB, transformA->position, transformB->position))
+            Utils::Profiler::start("Static Collision");
+            const uint32_t playerLayer = static_cast<uint32_t>(ECS::Components::CollisionLayer::Player);
+            const uint32_t enemyLayer = static_cast<uint32_t>(ECS::Components::CollisionLayer::Enemy);
+
+            auto& pool = Utils::ThreadPool::getInstance();
+            obstacleScratch.resize(pool.getThreadCount());
+
+            pool.parallelFor(bodies.size(), 128, [&](size_t begin, size_t end, size_t worker) {
+                auto& obstacles = obstacleScratch[worker];
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const Body& body = bodies[i];
+                    if ((body.layerIndex != playerLayer && body.layerIndex != enemyLayer) || body.collider->isTrigger)
+                        continue;
+
+                    sf::Vector2f& position = body.transform->position;
+                    float radius = body.collider->radius;
+                    obstacles.clear();
+                    staticWorld->queryObstacles(position.x - radius, position.y - radius,
+                                                position.x + radius, position.y + radius, obstacles);
+
+                    for (const StaticObstacle* obstacle : obstacles)
                     {
-                        // Calculate separation vector
-                        sf::Vector2f direction = transformB->position - transformA->position;
-                        float distance = Utils::Math::magnitude(direction);
-
-                        if (distance > 0.f)
-                        {
-                            direction = Utils::Math::normalize(direction);
-
-                            // Calculate overlap
-                            float overlap = 0.f;
-                            if (colliderA->shape == ECS::Components::ColliderShape::Circle &&
-                                colliderB->shape == ECS::Components::ColliderShape::Circle)
-                            {
-                                overlap = (colliderA->radius + colliderB->radius) - distance;
-                            }
-                            else
-                            {
-                                overlap = 10.f; // Default separation for non-circle
-                            }
-
-                            // Push apart
-                            sf::Vector2f separation = direction * (overlap * 0.5f);
-                            transformA->position -= separation;
-                            transformB->position += separation;
-                        }
+                        sf::Vector2f correction;
+                        if (obstacle->pushOut(position, radius, correction))
+                            position += correction;
                     }
                 }
-            }
-            Utils::Profiler::stop("Enemy Separation");
+            });
+            Utils::Profiler::stop("Static Collision");
         }
 
         ECS::EntityManager* entityManager;
         float playerDamageCooldown;
         float playerDamageInterval;
         float cullingRange;
-        Utils::SpatialGrid grid;
+
+        // Which layer pairs the broadphase visits at all
+        // (declared before broadphase: it keeps a pointer to it)
+        Utils::CollisionMatrix collisionMatrix;
+
+        // Broadphase binned per layer (backend swappable at runtime, see setBroadphase)
+        std::unique_ptr<Utils::LayeredBroadphase> broadphase;
+
+        // (layerA, layerB) -> contact type
+        std::array<std::array<PairRule, LayerCount>, LayerCount> pairRules{};
+
+        // Per-frame buffers (reused to avoid reallocations)
+        std::vector<Utils::BroadphaseProxy> proxies;
+        std::vector<Body> bodies;
+        std::vector<Utils::BroadphasePair> pairs;
+        std::array<std::vector<Utils::BroadphasePair>, ContactTypeCount> contacts;
+
+        // Contacts seen last frame (enter/stay/exit events)
+        Utils::ContactCache contactCache;
+
+        // Narrowphase buffers (SoA for the SIMD kernel)
+        std::vector<ClassifyScratch> classifyScratch;             // One per thread
+        std::vector<std::vector<TypedContact>> chunkContacts;     // One per task
+        std::vector<TypedContact> typedContacts;                  // Merged, in pair order
+
+        // Continuous projectile collision
+        BulletSystem* bullets = nullptr;                          // Owned by GameState
+        std::vector<uint32_t> sweptBullets;                       // Bullets inside cullingRange
+        std::vector<DamageEvent> projectileDamage;                // Merged, in bullet order
+        std::vector<std::vector<DamageEvent>> chunkDamage;        // One per task
+        std::vector<SweepScratch> sweepScratch;                   // One per thread
+        DamageSystem* damageSystem = nullptr;                     // Owned by GameState
+
+        // Static world geometry (owned by GameState)
+        const WorldGenerator* staticWorld = nullptr;
+        std::vector<std::vector<const StaticObstacle*>> obstacleScratch; // One per thread
+
+        // Sensors
+        std::vector<uint32_t> sensorCandidates;
+        std::vector<Utils::BroadphaseNeighbour> nearestScratch; // findNearest()
+        std::vector<ECS::Components::Sensor*> activeSensors;      // Sensors with a callback to run
+        size_t sensorOverlapCount = 0;
+
+        // Enemy separation (SoA copy of enemy positions, written back after solving)
+        Utils::SeparationSolver separationSolver;
+        std::vector<ECS::Components::Transform*> enemyTransforms;
+        std::vector<sf::Vector2f> enemyPositions;
+        std::vector<float> enemyRadii;
     };
 }
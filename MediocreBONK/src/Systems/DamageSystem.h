@@ -0,0 +1,133 @@
+#pragma once
+#include "../ECS/Entity.h"
+#include "../ECS/Components/Health.h"
+#include "../Utils/Profiler.h"
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+namespace MediocreBONK::Systems
+{
+    // Who dealt the damage (statistics, future resistances)
+    enum class DamageSource : uint8_t
+    {
+        Projectile,
+        Contact,
+        Other
+    };
+
+    struct DamageEvent
+    {
+        ECS::Entity* target;
+        uint64_t targetId; // Sort key: groups the events of one target
+        float amount;
+        DamageSource source;
+    };
+
+    /*
+     * OPTIMIZATION TECHNIQUE: DAMAGE BUFFER + BATCHED RESOLVE
+     *
+     * Problem:
+     * - Health::takeDamage() was called from inside the projectile hit loop:
+     *   onDamage/onDeath callbacks -> Enemy::onDeath -> XP gem spawn,
+     *   all while the collision loop was still iterating
+     * - Game state changed under the loop: it had to stay serial
+     *
+     * Solution: Record now, apply later
+     * - Producers (collision, contact damage) only append DamageEvents
+     *   (parallel producers fill per-chunk buffers and append them in order)
+     * - resolve(), once per frame after collision:
+     *   1. Sort events by target (stable: same order for any thread count)
+     *   2. Reduce: one summed amount per target, one Health lookup per target
+     *   3. Apply health changes (Health::applyDamage, no callbacks)
+     *   4. Collect the targets that died in this resolve
+     *   5. Then notify: onDamage once per target (summed), onDeath once per death
+     * - Nothing reacts to damage while detection is running
+     */
+    class DamageSystem
+    {
+    public:
+        void queue(ECS::Entity* target, float amount, DamageSource source)
+        {
+            events.push_back({ target, target->getId(), amount, source });
+        }
+
+        // Append events produced elsewhere (e.g. merged per-chunk buffers)
+        void queue(const std::vector<DamageEvent>& batch)
+        {
+            events.insert(events.end(), batch.begin(), batch.end());
+        }
+
+        size_t getPendingCount() const { return events.size(); }
+
+        // Entities killed by the last resolve()
+        const std::vector<ECS::Entity*>& getDeaths() const { return deaths; }
+
+        void resolve()
+        {
+            Utils::Profiler::start("Damage Resolve");
+            Utils::Profiler::record("Damage Events", static_cast<long long>(events.size()));
+
+            deaths.clear();
+            damaged.clear();
+            std::stable_sort(events.begin(), events.end(), [](const DamageEvent& a, const DamageEvent& b) {
+                return a.targetId < b.targetId;
+            });
+
+            // Reduce + apply
+            size_t i = 0;
+            while (i < events.size())
+            {
+                ECS::Entity* target = events[i].target;
+                float total = 0.f;
+                size_t end = i;
+                for (; end < events.size() && events[end].targetId == events[i].targetId; ++end)
+                    total += events[end].amount;
+                i = end;
+
+                auto* health = target->isActive() ? target->getComponent<ECS::Components::Health>() : nullptr;
+                if (!health || !health->applyDamage(total))
+                    continue;
+
+                damaged.push_back({ health, total });
+                if (health->isDead())
+                    deaths.push_back(target);
+            }
+            events.clear();
+
+            // Notify once every health change is done
+            for (const auto& entry : damaged)
+            {
+                if (entry.health->onDamageCallback)
+                    entry.health->onDamageCallback(entry.total);
+            }
+            for (auto* dead : deaths)
+            {
+                auto* health = dead->getComponent<ECS::Components::Health>();
+                if (health && health->onDeathCallback)
+                    health->onDeathCallback();
+            }
+
+            Utils::Profiler::record("Damaged Targets", static_cast<long long>(damaged.size()));
+            Utils::Profiler::stop("Damage Resolve");
+        }
+
+        void clear()
+        {
+            events.clear();
+            deaths.clear();
+            damaged.clear();
+        }
+
+    private:
+        struct DamagedTarget
+        {
+            ECS::Components::Health* health;
+            float total;
+        };
+
+        std::vector<DamageEvent> events;      // This frame, unresolved
+        std::vector<DamagedTarget> damaged;   // Last resolve
+        std::vector<ECS::Entity*> deaths;     // Last resolve
+    };
+}
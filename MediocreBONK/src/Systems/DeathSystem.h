@@ -0,0 +1,111 @@
+#pragma once
+#include "../ECS/Entity.h"
+#include "../ECS/Components/Transform.h"
+#include "../ECS/Components/XPDrop.h"
+#include "../Managers/EventManager.h"
+#include "../Utils/Profiler.h"
+#include "XPSystem.h"
+#include "ParticleSystem.h"
+#include <vector>
+#include <memory>
+#include <functional>
+#include <algorithm>
+
+namespace MediocreBONK::Systems
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: BATCHED DEATH PROCESSING
+     *
+     * Problem:
+     * - Every Enemy captured 'this' in Health::onDeathCallback; each death ran
+     *   its own cascade: XP gem spawn (scan of every gem), kill counter,
+     *   deactivate - N deaths = N cascades, N gem scans
+     * - A piercing shot through a packed horde kills dozens in one tick
+     *
+     * Solution: Collect deaths, process them in one pass per tick
+     * - DamageSystem::resolve() already lists this tick's deaths
+     * - process():
+     *   1. Gather position + XP of every dead enemy, deactivate it
+     *   2. One XPSystem::spawnXPGems() batch (gems indexed once, drops merged)
+     *   3. Death effects with a per-tick budget (mass kills don't spawn
+     *      hundreds of particle entities)
+     *   4. Kill counter += count, ONE EnemyKilled event for the whole batch
+     */
+    class DeathSystem
+    {
+    public:
+        DeathSystem(XPSystem* xpSystem, ParticleSystem* particleSystem)
+            : xpSystem(xpSystem)
+            , particleSystem(particleSystem)
+            , maxEffectsPerTick(8)
+        {}
+
+        // Called once per batch with the number of enemies killed (e.g. HUD kill counter)
+        void setOnKills(std::function<void(int)> callback) { onKills = std::move(callback); }
+
+        void setMaxEffectsPerTick(int max) { maxEffectsPerTick = max; }
+
+        void process(const std::vector<ECS::Entity*>& deaths)
+        {
+            if (deaths.empty())
+                return;
+
+            Utils::Profiler::start("Death Processing");
+            drops.clear();
+            for (auto* entity : deaths)
+            {
+                // Player death is handled by GameState (death screen)
+                if (!entity->isActive() || entity->tag != "Enemy")
+                    continue;
+
+                auto* transform = entity->getComponent<ECS::Components::Transform>();
+                auto* xpDrop = entity->getComponent<ECS::Components::XPDrop>();
+                if (transform)
+                    drops.push_back({ transform->position, xpDrop ? xpDrop->experienceValue : 0.f });
+
+                entity->setActive(false);
+            }
+
+            if (drops.empty())
+            {
+                Utils::Profiler::stop("Death Processing");
+                return;
+            }
+
+            if (xpSystem)
+                xpSystem->spawnXPGems(drops);
+
+            if (particleSystem)
+            {
+                size_t effects = std::min(drops.size(), static_cast<size_t>(std::max(maxEffectsPerTick, 0)));
+                for (size_t i = 0; i < effects; ++i)
+                    particleSystem->spawnSparks(drops[i].position, 3);
+            }
+
+            int killed = static_cast<int>(drops.size());
+            if (onKills)
+                onKills(killed);
+
+            auto event = Managers::makeEvent<Managers::EnemyKilledData>();
+            event->count = killed;
+            event->experienceValue = 0.f;
+            for (const auto& drop : drops)
+                event->experienceValue += drop.value;
+            Managers::EventManager::getInstance().queueEvent(Managers::GameEventType::EnemyKilled, std::move(event));
+
+            Utils::Profiler::record("Deaths", static_cast<long long>(killed));
+            Utils::Profiler::stop("Death Processing");
+        }
+
+        // Position + XP of each death of the last process() (valid until the next one)
+        const std::vector<XPSystem::XPDropRequest>& getLastDeaths() const { return drops; }
+
+    private:
+        XPSystem* xpSystem;
+        ParticleSystem* particleSystem;
+        int maxEffectsPerTick;
+        std::function<void(int)> onKills;
+
+        std::vector<XPSystem::XPDropRequest> drops; // Reused every tick
+    };
+}
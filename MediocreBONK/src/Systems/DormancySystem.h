@@ -0,0 +1,259 @@
+#pragma once
+#include "../ECS/EntityManager.h"
+#include "../ECS/Components/Transform.h"
+#include "../Utils/Math.h"
+#include "../Utils/Profiler.h"
+#include <SFML/System/Vector2.hpp>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace MediocreBONK::Systems
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: DORMANCY (SLEEPING ENTITIES)
+     *
+     * Problem:
+     * - Late game most entities are idle: XP gems outside the magnet,
+     *   power-ups bobbing far off-screen, enemies beyond AI::detectionRange
+     * - Each one still ran its components' update() every tick and was
+     *   inserted into the collision broadphase again (proxy, pairs, sensor queries)
+     *
+     * Solution: Idle entities fall asleep, the player's proximity wakes them
+     * - One rule per tag: sleepDistance / wakeDistance from the player
+     *   (wake < sleep: hysteresis, no flicker at the border) + an optional
+     *   idle test (enemies: AI::isIdle, the last decision was 'no force')
+     * - sleepIdle() (FrameScheduler job, a few Hz): awake entities of each
+     *   rule's tag that are far enough and idle -> Entity::setDormant(true),
+     *   indexed in the rule's sleeper grid (hash of SleepCellSize cells)
+     * - update() (every tick): only the grid cells overlapping each rule's
+     *   wake circle are visited, the sleepers inside the circle wake up
+     * - Dormant entities stay active: tag lists, rendering, expiry timers and
+     *   enemy culling still see them. EntityManager::update, CollisionSystem's
+     *   broadphase, AISystem and PowerUpSystem skip them
+     *
+     * Wake cost per tick ~ cells around the player, not the number of sleepers.
+     * Sleepers don't move: the grid is only touched when one sleeps or wakes.
+     *
+     * Stale sleepers (collected, expired, culled or freed while asleep) are
+     * dropped when a wake query meets them, or by the sweep in sleepIdle().
+     */
+    class DormancySystem
+    {
+    public:
+        // Extra idle test on top of the distance (nullptr: distance only)
+        using IdleTest = std::function<bool(ECS::Entity*)>;
+
+        static constexpr float SleepCellSize = 256.f;
+
+        DormancySystem(ECS::EntityManager* entityManager, ECS::Entity* player)
+            : entityManager(entityManager)
+            , player(player)
+        {}
+
+        // Entities tagged 'tag' sleep beyond sleepDistance from the player (if idle)
+        // and wake within wakeDistance (clamped to sleepDistance). Replaces the tag's rule.
+        void setRule(const std::string& tag, float sleepDistance, float wakeDistance, IdleTest isIdle = nullptr)
+        {
+            auto it = std::find_if(rules.begin(), rules.end(),
+                [&tag](const Rule& rule) { return rule.tag == tag; });
+            if (it == rules.end())
+            {
+                rules.emplace_back();
+                it = rules.end() - 1;
+                it->tag = tag;
+            }
+
+            it->sleepDistance = sleepDistance;
+            it->wakeDistance = std::min(wakeDistance, sleepDistance);
+            it->isIdle = std::move(isIdle);
+        }
+
+        // Wake the sleepers the player came close to (every tick, before entities update)
+        void update()
+        {
+            auto* playerTransform = player->getComponent<ECS::Components::Transform>();
+            if (!playerTransform || sleepers.empty())
+                return;
+
+            Utils::Profiler::start("Dormancy Wake");
+            for (auto& rule : rules)
+                wakeAround(rule, playerTransform->position);
+            Utils::Profiler::stop("Dormancy Wake");
+        }
+
+        // Put idle entities far from the player to sleep, drop stale sleepers
+        // (periodic: a FrameScheduler job)
+        void sleepIdle()
+        {
+            auto* playerTransform = player->getComponent<ECS::Components::Transform>();
+            if (!playerTransform)
+                return;
+
+            for (uint32_t r = 0; r < rules.size(); ++r)
+            {
+                const Rule& rule = rules[r];
+                float sleepSquared = rule.sleepDistance * rule.sleepDistance;
+
+                for (auto* entity : entityManager->getEntitiesByTag(rule.tag))
+                {
+                    if (!entity->isActive() || entity->isDormant())
+                        continue;
+
+                    auto* transform = entity->getComponent<ECS::Components::Transform>();
+                    if (!transform ||
+                        Utils::Math::distanceSquared(transform->position, playerTransform->position) <= sleepSquared)
+                        continue;
+
+                    if (rule.isIdle && !rule.isIdle(entity))
+                        continue;
+
+                    sleep(entity, r, transform->position);
+                }
+            }
+
+            dropStaleSleepers();
+            Utils::Profiler::record("Dormant Entities", static_cast<long long>(sleepers.size()));
+        }
+
+        size_t getDormantCount() const { return sleepers.size(); }
+
+    private:
+        struct Rule
+        {
+            std::string tag;
+            float sleepDistance = 0.f;
+            float wakeDistance = 0.f;
+            IdleTest isIdle;
+            std::unordered_map<uint64_t, std::vector<uint64_t>> cells; // Cell -> sleeping entity IDs
+        };
+
+        // Where a sleeping entity is indexed (each ID is in at most one cell)
+        struct Sleeper
+        {
+            uint32_t rule;
+            uint64_t cell;
+        };
+
+        static int64_t cellOf(float coordinate)
+        {
+            return static_cast<int64_t>(std::floor(coordinate / SleepCellSize));
+        }
+
+        static uint64_t cellKey(int64_t cellX, int64_t cellY)
+        {
+            return (static_cast<uint64_t>(cellY) << 32) ^ static_cast<uint64_t>(cellX & 0xFFFFFFFF);
+        }
+
+        void sleep(ECS::Entity* entity, uint32_t rule, const sf::Vector2f& position)
+        {
+            uint64_t id = entity->getId();
+
+            // Left over from an earlier life of this (pooled) entity
+            auto previous = sleepers.find(id);
+            if (previous != sleepers.end())
+            {
+                unindex(id, previous->second);
+                sleepers.erase(previous);
+            }
+
+            uint64_t cell = cellKey(cellOf(position.x), cellOf(position.y));
+            rules[rule].cells[cell].push_back(id);
+            sleepers[id] = { rule, cell };
+            entity->setDormant(true);
+        }
+
+        void wakeAround(Rule& rule, const sf::Vector2f& center)
+        {
+            if (rule.cells.empty())
+                return;
+
+            float radius = rule.wakeDistance;
+            float radiusSquared = radius * radius;
+            int64_t minX = cellOf(center.x - radius);
+            int64_t maxX = cellOf(center.x + radius);
+            int64_t minY = cellOf(center.y - radius);
+            int64_t maxY = cellOf(center.y + radius);
+
+            for (int64_t y = minY; y <= maxY; ++y)
+            {
+                for (int64_t x = minX; x <= maxX; ++x)
+                {
+                    auto it = rule.cells.find(cellKey(x, y));
+                    if (it == rule.cells.end())
+                        continue;
+
+                    auto& ids = it->second;
+                    size_t i = 0;
+                    while (i < ids.size())
+                    {
+                        auto* entity = entityManager->getEntity(ids[i]);
+                        if (entity && entity->isActive() && entity->isDormant())
+                        {
+                            auto* transform = entity->getComponent<ECS::Components::Transform>();
+                            if (transform && Utils::Math::distanceSquared(transform->position, center) > radiusSquared)
+                            {
+                                ++i;
+                                continue;
+                            }
+                            entity->setDormant(false);
+                        }
+
+                        // Woken or stale: swap-remove
+                        sleepers.erase(ids[i]);
+                        ids[i] = ids.back();
+                        ids.pop_back();
+                    }
+
+                    if (ids.empty())
+                        rule.cells.erase(it);
+                }
+            }
+        }
+
+        // Sleepers that left the game (or were reused) while far away
+        void dropStaleSleepers()
+        {
+            auto it = sleepers.begin();
+            while (it != sleepers.end())
+            {
+                auto* entity = entityManager->getEntity(it->first);
+                if (entity && entity->isActive() && entity->isDormant())
+                {
+                    ++it;
+                    continue;
+                }
+
+                unindex(it->first, it->second);
+                it = sleepers.erase(it);
+            }
+        }
+
+        void unindex(uint64_t id, const Sleeper& sleeper)
+        {
+            auto& cells = rules[sleeper.rule].cells;
+            auto cell = cells.find(sleeper.cell);
+            if (cell == cells.end())
+                return;
+
+            auto& ids = cell->second;
+            auto position = std::find(ids.begin(), ids.end(), id);
+            if (position != ids.end())
+            {
+                *position = ids.back();
+                ids.pop_back();
+            }
+            if (ids.empty())
+                cells.erase(cell);
+        }
+
+        ECS::EntityManager* entityManager;
+        ECS::Entity* player;
+        std::vector<Rule> rules;
+        std::unordered_map<uint64_t, Sleeper> sleepers; // Entity ID -> grid cell
+    };
+}
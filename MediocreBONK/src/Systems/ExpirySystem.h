@@ -0,0 +1,99 @@
+#pragma once
+#include "../ECS/EntityManager.h"
+#include "../ECS/Components/Expiry.h"
+#include "../Utils/TimerWheel.h"
+#include "../Utils/Profiler.h"
+#include <SFML/System/Time.hpp>
+#include <vector>
+
+namespace MediocreBONK::Systems
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: ENTITY LIFETIMES ON A TIMER WHEEL
+     *
+     * Problem:
+     * - XP gems (40s) and power-ups (30s) each counted their lifetime down in
+     *   their own update(): hundreds of live countdowns per frame, ~0 expiring
+     *
+     * Solution: Register the expiry once, get a batch of the expired entities
+     * - expireAfter(entity, seconds): one Utils::TimerWheel timer (user data =
+     *   entity ID) + an Expiry component holding the handle
+     * - update(): advance the wheel, validate each fired timer, deactivate the
+     *   whole batch; getExpired() lists it for systems that care
+     * - Cost per tick ~ number of expiring entities, not of live ones
+     *
+     * Validation (entities are pooled and keep their ID):
+     * - Entity freed or already inactive (collected, evicted) -> ignored
+     * - Expiry component handle differs (entity reused with a new timer) -> ignored
+     * - Entity tag differs (entity reused for something without a timer) -> ignored
+     * cancel() frees the timer early when the owner removes the entity itself
+     */
+    class ExpirySystem
+    {
+    public:
+        ExpirySystem(ECS::EntityManager* entityManager)
+            : entityManager(entityManager)
+        {}
+
+        // Deactivate 'entity' in 'seconds' (replaces a timer it already had)
+        void expireAfter(ECS::Entity* entity, float seconds)
+        {
+            cancel(entity);
+            Utils::TimerHandle handle = wheel.schedule(seconds, entity->getId());
+            entity->addComponent<ECS::Components::Expiry>(handle, entity->tag);
+        }
+
+        void cancel(ECS::Entity* entity)
+        {
+            auto* expiry = entity->getComponent<ECS::Components::Expiry>();
+            if (!expiry)
+                return;
+
+            wheel.cancel(expiry->handle);
+            expiry->handle = {};
+        }
+
+        void update(sf::Time dt)
+        {
+            Utils::Profiler::start("Expiry");
+            expired.clear();
+            for (const auto& timer : wheel.advance(dt))
+            {
+                auto* entity = entityManager->getEntity(timer.userData);
+                if (!entity || !entity->isActive())
+                    continue;
+
+                auto* expiry = entity->getComponent<ECS::Components::Expiry>();
+                if (!expiry || expiry->handle != timer.handle || expiry->tag != entity->tag)
+                    continue;
+
+                expiry->handle = {};
+                expired.push_back(entity);
+            }
+
+            // Batched: one pass over what actually expired this tick
+            for (auto* entity : expired)
+                entityManager->destroyEntity(entity);
+
+            Utils::Profiler::record("Timers Pending", static_cast<long long>(wheel.getPendingCount()));
+            Utils::Profiler::record("Timers Expired", static_cast<long long>(expired.size()));
+            Utils::Profiler::stop("Expiry");
+        }
+
+        // Entities deactivated by the last update()
+        const std::vector<ECS::Entity*>& getExpired() const { return expired; }
+
+        size_t getPendingCount() const { return wheel.getPendingCount(); }
+
+        void clear()
+        {
+            wheel.clear();
+            expired.clear();
+        }
+
+    private:
+        ECS::EntityManager* entityManager;
+        Utils::TimerWheel wheel;
+        std::vector<ECS::Entity*> expired; // Last update
+    };
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "../ECS/EntityManager.h"
+#include "../ECS/Components/Transform.h"
+#include "../Utils/FlowField.h"
+#include "../Utils/Profiler.h"
+#include "WorldGenerator.h"
+
+namespace MediocreBONK::Systems
+{
+    /*
+     * Shared pathing toward the player (see Utils::FlowField)
+     * - One flow field, centered on the player, sampled by every chasing AI
+     *   (SpawnSystem hands it to the enemies it spawns)
+     * - update(): enemy positions -> crowd density, then the field update
+     *   (obstacle tests for new cells + Dijkstra only when the player changed cell)
+     * - Runs as a FrameScheduler job, profiled under the job's name (10 Hz is
+     *   plenty: enemies close to the player steer at it directly)
+     */
+    class PathingSystem
+    {
+    public:
+        PathingSystem(ECS::EntityManager* entityManager, ECS::Entity* player, const WorldGenerator* world)
+            : entityManager(entityManager)
+            , player(player)
+            , world(world)
+            , flowField(40.f, 64, 1.f) // 2560px window: covers the spawn ring
+        {}
+
+        void update()
+        {
+            auto* playerTransform = player->getComponent<ECS::Components::Transform>();
+            if (!playerTransform)
+                return;
+
+            for (auto* enemy : entityManager->getEntitiesByTag("Enemy"))
+            {
+                if (auto* transform = enemy->getComponent<ECS::Components::Transform>())
+                    flowField.addDensity(transform->position);
+            }
+
+            flowField.update(playerTransform->position, [this](const sf::Vector2f& center, float halfCell) {
+                return world && world->overlapsObstacle(center, halfCell);
+            });
+
+            Utils::Profiler::record("Flow Field Reachable", static_cast<long long>(flowField.getReachableCount()));
+        }
+
+        const Utils::FlowField* getFlowField() const { return &flowField; }
+
+    private:
+        ECS::EntityManager* entityManager;
+        ECS::Entity* player;
+        const WorldGenerator* world;
+        Utils::FlowField flowField;
+    };
+}
@@ -3,10 +3,14 @@
 #include "../ECS/Components/Transform.h"
 #include "../ECS/Components/Collider.h"
 #include "../Entities/PowerUp.h"
+#include "ExpirySystem.h"
 #include "../Utils/Random.h"
 #include "../Utils/Math.h"
+#include "../Utils/ObjectPool.h"
+#include "../Utils/FrameScheduler.h"
 #include <SFML/System/Time.hpp>
 #include <memory>
+#include <algorithm>
 #include <vector>
 
 namespace MediocreBONK::Systems
@@ -19,56 +23,115 @@ namespace MediocreBONK::Systems
             , player(player)
             , spawnTimer(0.f)
             , spawnInterval(20.f) // Spawn power-up every 20 seconds
+            , expirySystem(nullptr)
+            , scheduler(nullptr)
+            , spawnJob(0)
         {}
 
-        void update(sf::Time dt)
+        // Power-up despawn timers (without it power-ups stay until collected)
+        void setExpirySystem(ExpirySystem* system) { expirySystem = system; }
+
+        // Spawn power-ups as a staggered scheduler job instead of an own timer
+        void setScheduler(Utils::FrameScheduler* frameScheduler)
         {
-            spawnTimer += dt.asSeconds();
+            scheduler = frameScheduler;
+            spawnJob = scheduler->add("PowerUp Spawn", spawnInterval, 50.f,
+                [this](uint32_t, uint32_t) { spawnRandomPowerUp(); });
+        }
 
+        void update(sf::Time dt)
+        {
             // Spawn power-up periodically
-            if (spawnTimer >= spawnInterval)
+            if (!scheduler)
             {
-                spawnTimer = 0.f;
-                spawnRandomPowerUp();
+                spawnTimer += dt.asSeconds();
+                if (spawnTimer >= spawnInterval)
+                {
+                    spawnTimer = 0.f;
+                    spawnRandomPowerUp();
+                }
             }
 
-            // Update all power-ups
+            // Collection is handled by CollisionSystem (player-pickup pairs, see
+            // PowerUp's onCollisionEnter) and despawn by ExpirySystem, both earlier
+            // in the tick: drop those wrappers before touching any of them
+            releaseStalePowerUps();
+
+            // Update all power-ups (all still bound to a live "PowerUp" entity)
             for (auto& powerUp : powerUps)
             {
-                if (powerUp && powerUp->getEntity()->isActive())
-                {
+                // Dormant (far off-screen): no bobbing until DormancySystem wakes it
+                if (!powerUp->getEntity()->isDormant())
                     powerUp->update(dt);
-                }
             }
-
-            // Check for collection
-            checkCollision();
-
-            // Remove inactive power-ups
-            powerUps.erase(
-                std::remove_if(powerUps.begin(), powerUps.end(),
-                    [](const std::unique_ptr<Entities::PowerUp>& p) {
-                        return !p || !p->getEntity()->isActive();
-                    }),
-                powerUps.end()
-            );
         }
 
         void spawnPowerUp(Entities::PowerUpType type, const sf::Vector2f& position)
         {
-            auto powerUp = Entities::PowerUpFactory::create(entityManager, type, position);
-            if (powerUp)
-            {
-                powerUps.push_back(std::move(powerUp));
-            }
+            // createEntity() may recycle the entity of a collected/expired power-up:
+            // its old wrapper must be gone before a new one hooks the same collider
+            releaseStalePowerUps();
+
+            // Wrapper built in a pooled slot (returned when erased from powerUps)
+            auto* entity = entityManager->createEntity();
+            if (!entity)
+                return;
+
+            powerUps.push_back(powerUpPool.acquire(entity, position,
+                Entities::PowerUpFactory::getData(type), entityManager));
+
+            if (expirySystem)
+                expirySystem->expireAfter(entity, PowerUpLifetime);
+        }
+
+        // ExpirySystem batch of this tick: release the wrappers of despawned
+        // power-ups before anything can recycle their entities
+        void onExpired(const std::vector<ECS::Entity*>& expired)
+        {
+            bool anyPowerUp = std::any_of(expired.begin(), expired.end(),
+                [](const ECS::Entity* entity) { return entity->tag == "PowerUp"; });
+            if (anyPowerUp)
+                releaseStalePowerUps();
         }
 
         void setSpawnInterval(float interval)
         {
             spawnInterval = interval;
+            if (scheduler)
+                scheduler->setPeriod(spawnJob, interval);
         }
 
     private:
+        /*
+         * Wrappers are checked through their entity ID, never the stored pointers:
+         * a collected or expired power-up's entity can be freed, or recycled by
+         * createEntity() in the same tick (e.g. as an XP gem at the entity cap),
+         * which replaces the components the wrapper cached
+         * - Entity gone, inactive or re-tagged -> wrapper released, slot recycled
+         * - Its components are only unhooked while the entity is still tagged
+         *   "PowerUp" (nobody re-added components since)
+         */
+        void releaseStalePowerUps()
+        {
+            size_t i = 0;
+            while (i < powerUps.size())
+            {
+                auto& powerUp = powerUps[i];
+                auto* entity = entityManager->getEntity(powerUp->getEntityId());
+                if (entity && entity->isActive() && entity->tag == "PowerUp")
+                {
+                    ++i;
+                    continue;
+                }
+
+                powerUp->release(entity && entity->tag == "PowerUp");
+
+                // Swap-remove, the popped handle returns the slot to the pool
+                std::swap(powerUp, powerUps.back());
+                powerUps.pop_back();
+            }
+        }
+
         void spawnRandomPowerUp()
         {
             auto* playerTransform = player->getComponent<ECS::Components::Transform>();
@@ -151,44 +214,19 @@ namespace MediocreBONK::Systems
                 return Entities::PowerUpType::InvulnerabilityBoost;
         }
 
-        void checkCollision()
-        {
-            auto* playerTransform = player->getComponent<ECS::Components::Transform>();
-            auto* playerCollider  = player->getComponent<ECS::Components::Collider>();
-
-            if (!playerTransform || !playerCollider)
-                return;
-
-            for (auto& powerUp : powerUps)
-            {
-                if (!powerUp || !powerUp->getEntity()->isActive() || powerUp->isCollected())
-                    continue;
-
-                auto* powerUpTransform = powerUp->getEntity()->getComponent<ECS::Components::Transform>();
-                auto* powerUpCollider  = powerUp->getEntity()->getComponent<ECS::Components::Collider>();
-
-                if (!powerUpTransform || !powerUpCollider)
-                    continue;
-
-                // Check distance for collision
-                float distance = Utils::Math::distance(
-                    playerTransform->position,
-                    powerUpTransform->position
-                );
-
-                float combinedRadius = playerCollider->radius + powerUpCollider->radius;
-
-                if (distance < combinedRadius)
-                {
-                    powerUp->collect(player);
-                }
-            }
-        }
-
         ECS::EntityManager* entityManager;
         ECS::Entity* player;
-        std::vector<std::unique_ptr<Entities::PowerUp>> powerUps;
+        using PowerUpHandle = Utils::ObjectPool<Entities::PowerUp>::Handle;
+
+        static constexpr float PowerUpLifetime = 30.f; // Despawn after 30 seconds
+
+        // Declared before powerUps: handles must be destroyed before their pool
+        Utils::ObjectPool<Entities::PowerUp> powerUpPool{ 8 };
+        std::vector<PowerUpHandle> powerUps;
         float spawnTimer;
         float spawnInterval;
+        ExpirySystem* expirySystem;
+        Utils::FrameScheduler* scheduler;
+        Utils::JobId spawnJob;
     };
 }
@@ -5,12 +5,39 @@
 #include "../Utils/Random.h"
 #include "../Utils/Logger.h"
 #include "../Utils/Math.h"
+#include "../Utils/ObjectPool.h"
+#include "../Utils/FrameScheduler.h"
 #include <SFML/System/Time.hpp>
 #include <memory>
 #include <vector>
+#include <unordered_map>
 
 namespace MediocreBONK::Systems
 {
+    /*
+     * DESIGN PATTERN: POOLED ENEMY WRAPPERS (tied to entity handles)
+     *
+     * Problem:
+     * - spawnEnemy() pushed a unique_ptr<Enemy> that was never removed:
+     *   one wrapper per enemy EVER spawned (memory grew for the whole run)
+     * - Dead/culled wrappers kept Entity pointers that EntityManager cleanup
+     *   had already freed
+     *
+     * Solution: Wrappers live in a Utils::ObjectPool, bound to an entity ID
+     * - liveEnemies: pool handles of the wrappers bound to an entity,
+     *   liveIndex: entity ID -> position in liveEnemies (O(1) rebinding)
+     * - Every update, releaseDeadEnemies() looks each live wrapper's entity up
+     *   BY ID (never through the stored pointer, it may be freed):
+     *   gone, inactive (killed/culled) or re-tagged -> wrapper released
+     *   (damage callback cleared) and its handle dropped (slot recycled)
+     * - spawnEnemy() constructs the wrapper in a recycled slot: no heap
+     *   allocation once the pool has grown to the peak enemy count
+     * - A pooled entity keeps its ID: if it comes back as an enemy before the
+     *   sweep, its still-bound wrapper is simply re-initialized
+     *
+     * Memory is bounded by the PEAK number of simultaneous enemies, not by the
+     * number spawned: flat in long sessions.
+     */
     class SpawnSystem
     {
     public:
@@ -25,31 +52,60 @@ namespace MediocreBONK::Systems
             , despawnDistance(despawnDistance) // Screen-relative despawn distance
             , cullCheckTimer(0.f)
             , cullCheckInterval(1.f) // Check for culling every 1 second
-            , onEnemyDeathXPCallback(nullptr)
+            , scheduler(nullptr)
+            , spawnJob(0)
+            , flowField(nullptr)
         {}
 
+        // Run spawn waves and culling as staggered scheduler jobs instead of own timers
+        // Culling is amortised: each of CullSlices ticks checks its share of the enemies
+        void setScheduler(Utils::FrameScheduler* frameScheduler)
+        {
+            scheduler = frameScheduler;
+            spawnJob = scheduler->add("Spawn Wave", spawnInterval, 150.f,
+                [this](uint32_t, uint32_t) { spawnWave(); });
+            scheduler->add("Enemy Cull", cullCheckInterval, 200.f,
+                [this](uint32_t slice, uint32_t sliceCount) { cullDistantEnemies(slice, sliceCount); }, CullSlices);
+        }
+
+        // Chasers spawned from now on path along this field
+        void setFlowField(const Utils::FlowField* field)
+        {
+            flowField = field;
+        }
+
         void update(sf::Time dt)
         {
-            spawnTimer += dt.asSeconds();
+            // Return wrappers of enemies killed/culled/freed since the last update
+            releaseDeadEnemies();
 
-            if (spawnTimer >= spawnInterval)
+            if (!scheduler)
             {
-                spawnTimer = 0.f;
-                spawnWave();
-            }
+                spawnTimer += dt.asSeconds();
 
-            // Periodically cull distant enemies
-            cullCheckTimer += dt.asSeconds();
-            if (cullCheckTimer >= cullCheckInterval)
-            {
-                cullCheckTimer = 0.f;
-                cullDistantEnemies();
+                if (spawnTimer >= spawnInterval)
+                {
+                    spawnTimer = 0.f;
+                    spawnWave();
+                }
+
+                // Periodically cull distant enemies
+                cullCheckTimer += dt.asSeconds();
+                if (cullCheckTimer >= cullCheckInterval)
+                {
+                    cullCheckTimer = 0.f;
+                    cullDistantEnemies(0, 1);
+                }
             }
+
+            enemyPool.recordStats("Enemy Wrappers");
         }
 
         void setSpawnInterval(float interval)
         {
             spawnInterval = interval;
+            if (scheduler)
+                scheduler->setPeriod(spawnJob, interval);
         }
 
         void setMaxEnemies(int max)
@@ -59,37 +115,83 @@ namespace MediocreBONK::Systems
 
         void spawnEnemy(MediocreBONK::Entities::EnemyType type, const sf::Vector2f& position)
         {
-            auto enemy = MediocreBONK::Entities::EnemyFactory::create(entityManager, type, position, player);
+            auto* entity = entityManager->createEntity();
+            if (!entity)
+                return;
+
+            auto data = MediocreBONK::Entities::EnemyFactory::getScaledData(type);
+            auto* enemy = findBoundEnemy(entity->getId());
             if (enemy)
             {
-                // Set XP drop callback
-                if (onEnemyDeathXPCallback)
-                {
-                    enemy->setOnDeathXPCallback(onEnemyDeathXPCallback);
-                }
-
-                enemy->onSpawn();
-                enemies.push_back(std::move(enemy));
+                enemy->initialize(entity, position, data, player);
             }
+            else
+            {
+                liveIndex[entity->getId()] = liveEnemies.size();
+                liveEnemies.push_back(enemyPool.acquire(entity, position, data, player));
+                enemy = liveEnemies.back().get();
+            }
+
+            if (auto* ai = entity->getComponent<ECS::Components::AI>())
+                ai->setFlowField(flowField);
+
+            enemy->onSpawn();
         }
 
-        void setOnEnemyDeathXPCallback(std::function<void(sf::Vector2f, float)> callback)
+        size_t getLiveEnemyCount() const { return liveEnemies.size(); }
+        size_t getPooledEnemyCount() const { return enemyPool.getStats().capacity; }
+
+    private:
+        // Wrapper still bound to this (recycled) entity ID, nullptr if none
+        MediocreBONK::Entities::Enemy* findBoundEnemy(uint64_t entityId)
         {
-            onEnemyDeathXPCallback = callback;
+            auto bound = liveIndex.find(entityId);
+            return bound != liveIndex.end() ? liveEnemies[bound->second].get() : nullptr;
         }
 
-    private:
-        void cullDistantEnemies()
+        void releaseDeadEnemies()
+        {
+            size_t i = 0;
+            while (i < liveEnemies.size())
+            {
+                auto& enemy = liveEnemies[i];
+                uint64_t entityId = enemy->getEntityId();
+
+                // Lookup by ID: nullptr once EntityManager cleanup freed the entity
+                auto* entity = entityManager->getEntity(entityId);
+                if (entity && entity->isActive() && entity->tag == "Enemy")
+                {
+                    ++i;
+                    continue;
+                }
+
+                enemy->release(entity != nullptr);
+                liveIndex.erase(entityId);
+
+                // Swap-remove (order of live wrappers does not matter), the
+                // popped handle returns the slot to the pool
+                std::swap(enemy, liveEnemies.back());
+                liveEnemies.pop_back();
+                if (i < liveEnemies.size())
+                    liveIndex[liveEnemies[i]->getEntityId()] = i; // Moved into the hole
+            }
+        }
+
+        // Checks slice 'slice' of 'sliceCount' equal chunks of the enemy list
+        void cullDistantEnemies(uint32_t slice, uint32_t sliceCount)
         {
             auto* playerTransform = player->getComponent<ECS::Components::Transform>();
             if (!playerTransform)
                 return;
 
-            auto enemies = entityManager->getEntitiesByTag("Enemy");
+            const auto& enemies = entityManager->getEntitiesByTag("Enemy");
+            size_t begin = enemies.size() * slice / sliceCount;
+            size_t end = enemies.size() * (slice + 1) / sliceCount;
             int culledCount = 0;
 
-            for (auto* enemy : enemies)
+            for (size_t i = begin; i < end; ++i)
             {
+                auto* enemy = enemies[i];
                 auto* enemyTransform = enemy->getComponent<ECS::Components::Transform>();
                 if (!enemyTransform)
                     continue;
@@ -180,7 +282,12 @@ namespace MediocreBONK::Systems
 
         ECS::EntityManager* entityManager;
         ECS::Entity* player;
-        std::vector<std::unique_ptr<MediocreBONK::Entities::Enemy>> enemies;
+
+        // ENEMY WRAPPER POOL (see class comment)
+        // Declared before liveEnemies: handles must be destroyed before their pool
+        Utils::ObjectPool<MediocreBONK::Entities::Enemy> enemyPool{ 32 };
+        std::vector<Utils::ObjectPool<MediocreBONK::Entities::Enemy>::Handle> liveEnemies; // Bound to an entity
+        std::unordered_map<uint64_t, size_t> liveIndex; // Entity ID -> index in liveEnemies
 
         float spawnTimer;
         float spawnInterval;
@@ -190,6 +297,12 @@ namespace MediocreBONK::Systems
         float cullCheckTimer;
         float cullCheckInterval;
 
-        std::function<void(sf::Vector2f, float)> onEnemyDeathXPCallback;
+        // FRAME SCHEDULER (optional, see setScheduler)
+        static constexpr uint32_t CullSlices = 4;
+        Utils::FrameScheduler* scheduler;
+        Utils::JobId spawnJob;
+
+        const Utils::FlowField* flowField; // Shared chaser pathing (optional)
+
     };
 }
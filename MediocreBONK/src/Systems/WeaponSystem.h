@@ -2,24 +2,82 @@
 #include "../ECS/EntityManager.h"
 #include "../ECS/Components/Transform.h"
 #include "../ECS/Components/Weapon.h"
-#include "../ECS/Components/Physics.h"
-#include "../ECS/Components/Projectile.h"
 #include "../ECS/Components/Collider.h"
 #include "../Utils/Math.h"
 #include "../Utils/Logger.h"
+#include "BulletSystem.h"
+#include "CollisionSystem.h"
 #include <SFML/Graphics.hpp>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <limits>
 
 namespace MediocreBONK::Systems
 {
+    /*
+     * OPTIMIZATION TECHNIQUE: SPATIAL TARGETING + PER-FRAME TARGET CACHE
+     *
+     * Problem:
+     * - findNearestTarget() copied every entity with the target tag and computed
+     *   a sqrt distance to each one: O(enemies) per shot
+     * - It ran again for every burst shot of every weapon
+     *
+     * Solution:
+     * - No index of its own: targets are looked up in the collision
+     *   broadphase, which already bins enemies / the player by layer every tick
+     *   (CollisionSystem::findNearest, runs after collision)
+     * - Nearest / k-nearest = expanding ring search in the target layer's bin
+     *   with squared distances: a few cells around the shooter, whatever the
+     *   enemy count
+     * - Nearest target cache: owner entity -> target for the current frame,
+     *   shared by all shots of that owner in the frame (optional, on by default)
+     *
+     * FIRE PATTERNS (WeaponData::pattern):
+     * - Fan / Ring / Spiral: one volley per trigger pull, the Weapon's cached
+     *   direction table (FirePatternTable) rotated by the aim and handed to
+     *   BulletSystem::spawnVolley in one call: no per-shot trig or entity
+     * - BurstStream: one shot every burstDelay, same path with a 1-entry table
+     */
     class WeaponSystem
     {
     public:
-        WeaponSystem(ECS::EntityManager* entityManager)
+        WeaponSystem(ECS::EntityManager* entityManager, BulletSystem* bullets)
             : entityManager(entityManager)
+            , bullets(bullets)
+            , collisionSystem(nullptr)
+            , targetCacheEnabled(true)
         {}
 
+        // Broadphase the targets are searched in (nullptr = nothing to target)
+        void setCollisionSystem(CollisionSystem* system) { collisionSystem = system; }
+
+        // Share one nearest-target lookup between all shots of an owner per frame
+        void setTargetCacheEnabled(bool enabled) { targetCacheEnabled = enabled; }
+        bool isTargetCacheEnabled() const { return targetCacheEnabled; }
+
+        // TARGETING QUERY: up to k active entities on 'layer' nearest to position (nearest first)
+        void findNearestOnLayer(const sf::Vector2f& position, ECS::Components::CollisionLayer layer, size_t k,
+                                std::vector<ECS::Entity*>& result,
+                                float maxDistance = std::numeric_limits<float>::max())
+        {
+            result.clear();
+            if (collisionSystem)
+                collisionSystem->findNearest(position, k, maxDistance, ECS::Components::Collider::layerBit(layer), result);
+        }
+
+        ECS::Entity* findNearestOnLayer(const sf::Vector2f& position, ECS::Components::CollisionLayer layer,
+                                        float maxDistance = std::numeric_limits<float>::max())
+        {
+            findNearestOnLayer(position, layer, 1, nearest, maxDistance);
+            return nearest.empty() ? nullptr : nearest.front();
+        }
+
         void update(sf::Time dt)
         {
+            // New frame: targets moved, cached targets are stale
+            nearestTargetCache.clear();
+
             // Get all entities with weapons
             auto weaponEntities = entityManager->getEntitiesWithComponents<
                 ECS::Components::Transform,
@@ -48,10 +106,9 @@ namespace MediocreBONK::Systems
                         ECS::Entity* target = findNearestTarget(entity);
                         if (target)
                         {
-                            int index = weapon->data.projectileCount - weapon->burstShotsRemaining;
-                            fireSingleShot(entity, transform, weapon, target, index);
+                            fireVolley(entity, transform, weapon, target);
                             weapon->burstShotsRemaining--;
-                            weapon->burstTimer = weapon->burstDelay;
+                            weapon->burstTimer = weapon->data.burstDelay;
                         }
                         else
                         {
@@ -85,122 +142,82 @@ namespace MediocreBONK::Systems
             if (!sourceTransform)
                 return nullptr;
 
-            std::string targetTag = (source->tag == "Player") ? "Enemy" : "Player";
-            auto targets = entityManager->getEntitiesByTag(targetTag);
-
-            ECS::Entity* nearest = nullptr;
-            float nearestDistance = std::numeric_limits<float>::max();
-
-            for (auto* target : targets)
+            // Same owner, same frame: same target
+            if (targetCacheEnabled)
             {
-                auto* targetTransform = target->getComponent<ECS::Components::Transform>();
-                if (!targetTransform)
-                    continue;
-
-                float distance = Utils::Math::distance(sourceTransform->position, targetTransform->position);
-                if (distance < nearestDistance)
-                {
-                    nearestDistance = distance;
-                    nearest = target;
-                }
+                auto it = nearestTargetCache.find(source->getId());
+                if (it != nearestTargetCache.end())
+                    return it->second;
             }
 
-            return nearest;
+            auto targetLayer = (source->tag == "Player")
+                ? ECS::Components::CollisionLayer::Enemy
+                : ECS::Components::CollisionLayer::Player;
+            ECS::Entity* target = findNearestOnLayer(sourceTransform->position, targetLayer);
+
+            if (targetCacheEnabled)
+                nearestTargetCache[source->getId()] = target;
+            return target;
         }
 
         void startFiring(ECS::Entity* source, ECS::Components::Transform* transform,
                        ECS::Components::Weapon* weapon, ECS::Entity* target)
         {
-            // Initialize burst
+            // Fan / Ring / Spiral: the whole pattern in one volley
+            if (weapon->data.pattern != ECS::Components::FirePattern::BurstStream)
+            {
+                fireVolley(source, transform, weapon, target);
+                return;
+            }
+
+            // Burst stream: first shot now, the rest every burstDelay (see update)
             weapon->burstShotsRemaining = weapon->data.projectileCount;
-            
-            // Fire first shot immediately
-            int index = 0;
-            fireSingleShot(source, transform, weapon, target, index);
+            fireVolley(source, transform, weapon, target);
             weapon->burstShotsRemaining--;
-            weapon->burstTimer = weapon->burstDelay;
+            weapon->burstTimer = weapon->data.burstDelay;
         }
 
-        void fireSingleShot(ECS::Entity* source, ECS::Components::Transform* transform,
-                           ECS::Components::Weapon* weapon, ECS::Entity* target, int index)
+        // BATCHED EMISSION: the weapon's precomputed pattern table, rotated by the aim
+        // (or the spiral orientation), goes to the bullet store in one call
+        void fireVolley(ECS::Entity* source, ECS::Components::Transform* transform,
+                        ECS::Components::Weapon* weapon, ECS::Entity* target)
         {
             auto* targetTransform = target->getComponent<ECS::Components::Transform>();
             if (!targetTransform)
                 return;
 
-            // Calculate direction to target
-            sf::Vector2f direction = Utils::Math::normalize(targetTransform->position - transform->position);
+            const ECS::Components::WeaponData& data = weapon->data;
+            sf::Vector2f rotation = (data.pattern == ECS::Components::FirePattern::Spiral)
+                ? weapon->nextSpiralRotation()
+                : Utils::Math::normalize(targetTransform->position - transform->position);
 
-            // If we have a delay, we want a stream (ignore spread).
-            // If delay is 0 (shotgun), we want spread.
-            bool ignoreSpread = (weapon->burstDelay > 0.f);
+            const auto& directions = weapon->getVolleyDirections();
+            auto layer = (source->tag == "Player")
+                ? ECS::Components::CollisionLayer::PlayerProjectile
+                : ECS::Components::CollisionLayer::EnemyProjectile;
+            float lifetime = data.range / data.projectileSpeed;
 
-            createProjectile(source, transform->position, direction, weapon, index, ignoreSpread);
-        }
-
-        void createProjectile(ECS::Entity* source, const sf::Vector2f& position,
-                             const sf::Vector2f& baseDirection,
-                             ECS::Components::Weapon* weapon, int index, bool ignoreSpread = false)
-        {
-            // Create projectile entity
-            auto* projectile = entityManager->createEntity();
-            if (!projectile)
-                return;
-
-            projectile->tag = source->tag + "Projectile";
-
-            // Calculate spread angle
-            float spreadAngle = 0.f;
-            if (!ignoreSpread && weapon->data.projectileCount > 1)
-            {
-                float totalSpread = weapon->data.spread;
-                float angleStep = totalSpread / (weapon->data.projectileCount - 1);
-                spreadAngle = -totalSpread / 2.f + angleStep * index;
-            }
-
-            // Apply spread to direction
-            float radians = Utils::Math::toRadians(spreadAngle);
-            float cos = std::cos(radians);
-            float sin = std::sin(radians);
-            sf::Vector2f direction(
-                baseDirection.x * cos - baseDirection.y * sin,
-                baseDirection.x * sin + baseDirection.y * cos
-            );
-
-            // Add components
-            auto* transform = projectile->addComponent<ECS::Components::Transform>(position);
-            auto* physics = projectile->addComponent<ECS::Components::Physics>();
-            physics->velocity = direction * weapon->data.projectileSpeed;
-            physics->drag = 1.0f; // No drag for projectiles
-
-            // Calculate lifetime from range
-            float lifetime = weapon->data.range / weapon->data.projectileSpeed;
-            auto* projComp = projectile->addComponent<ECS::Components::Projectile>(
-                weapon->data.damage,
-                weapon->data.piercing,
-                lifetime,
-                source->tag
-            );
-
-            // Add collider for collision detection (small circle)
-            auto* collider = projectile->addComponent<ECS::Components::Collider>(
-                ECS::Components::ColliderShape::Circle,
-                5.f  // Small 5 pixel radius for projectiles
-            );
+            size_t fired = bullets->spawnVolley(transform->position, directions.data(), directions.size(), rotation,
+                                                data.projectileSpeed, data.damage, data.piercing, lifetime,
+                                                5.f, layer); // Small 5 pixel radius
 
             static bool loggedProjectileCreation = false;
-            if (!loggedProjectileCreation)
+            if (fired > 0 && !loggedProjectileCreation)
             {
-                Utils::Logger::info("Created projectile with damage: " + std::to_string(weapon->data.damage) +
-                                   ", speed: " + std::to_string(weapon->data.projectileSpeed) +
+                Utils::Logger::info("Created projectile with damage: " + std::to_string(data.damage) +
+                                   ", speed: " + std::to_string(data.projectileSpeed) +
                                    ", owner: " + source->tag);
                 loggedProjectileCreation = true;
             }
-
-            // Add visual (simple circle for now, will use sprite later)
-            // auto* sprite = projectile->addComponent<ECS::Components::Sprite>(weapon->data.projectileSprite, 2);
         }
 
         ECS::EntityManager* entityManager;
+        BulletSystem* bullets;
+
+        // Targeting
+        CollisionSystem* collisionSystem;
+        bool targetCacheEnabled;
+        std::unordered_map<uint64_t, ECS::Entity*> nearestTargetCache; // Owner ID -> target (this frame)
+        std::vector<ECS::Entity*> nearest;                            // Query scratch
     };
 }
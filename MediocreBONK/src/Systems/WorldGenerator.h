@@ -1,10 +1,16 @@
 #pragma once
 #include "../ECS/Components/Transform.h"
 #include "../Utils/Logger.h"
+#include "../Utils/Math.h"
+#include "../Utils/Random.h"
+#include "../Utils/StaticAABBTree.h"
+#include "../Utils/FrameArena.h"
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <unordered_map>
+#include <random>
 #include <cmath>
+#include <cstdint>
 
 namespace MediocreBONK::Systems
 {
@@ -28,16 +34,183 @@ namespace MediocreBONK::Systems
         }
     };
 
+    enum class ObstacleShape
+    {
+        Rock,   // Circle
+        Wall    // Axis-aligned rectangle
+    };
+
+    // Static piece of world geometry (not an entity: never moves, never updates)
+    struct StaticObstacle
+    {
+        ObstacleShape shape;
+        sf::Vector2f center;
+        sf::Vector2f halfSize; // Wall
+        float radius;          // Rock
+
+        Utils::StaticAABBTree::Box getBounds() const
+        {
+            sf::Vector2f extent = (shape == ObstacleShape::Rock) ? sf::Vector2f(radius, radius) : halfSize;
+            return { center.x - extent.x, center.y - extent.y, center.x + extent.x, center.y + extent.y };
+        }
+
+        // Push a circle out of this obstacle
+        // Returns true (and the minimum translation) if they overlap
+        bool pushOut(const sf::Vector2f& position, float circleRadius, sf::Vector2f& correction) const
+        {
+            if (shape == ObstacleShape::Rock)
+            {
+                sf::Vector2f offset = position - center;
+                float radiusSum = radius + circleRadius;
+                float distanceSq = offset.x * offset.x + offset.y * offset.y;
+                if (distanceSq >= radiusSum * radiusSum)
+                    return false;
+
+                float distance = std::sqrt(distanceSq);
+                sf::Vector2f normal = distance > 0.0001f ? offset / distance : sf::Vector2f(1.f, 0.f);
+                correction = normal * (radiusSum - distance);
+                return true;
+            }
+
+            // Wall: closest point on the box
+            sf::Vector2f local = position - center;
+            sf::Vector2f closest(Utils::Math::clamp(local.x, -halfSize.x, halfSize.x),
+                                 Utils::Math::clamp(local.y, -halfSize.y, halfSize.y));
+
+            if (closest == local)
+            {
+                // Center inside the box: leave through the nearest face
+                float pushX = halfSize.x - std::abs(local.x) + circleRadius;
+                float pushY = halfSize.y - std::abs(local.y) + circleRadius;
+                if (pushX < pushY)
+                    correction = sf::Vector2f(local.x < 0.f ? -pushX : pushX, 0.f);
+                else
+                    correction = sf::Vector2f(0.f, local.y < 0.f ? -pushY : pushY);
+                return true;
+            }
+
+            sf::Vector2f offset = local - closest;
+            float distanceSq = offset.x * offset.x + offset.y * offset.y;
+            if (distanceSq >= circleRadius * circleRadius)
+                return false;
+
+            float distance = std::sqrt(distanceSq);
+            correction = offset / distance * (circleRadius - distance);
+            return true;
+        }
+
+        // First contact time (0..1) of a circle moving start -> start + delta
+        // Walls use the box grown by the radius (corners slightly conservative)
+        bool sweep(const sf::Vector2f& start, const sf::Vector2f& delta, float circleRadius, float& time) const
+        {
+            if (shape == ObstacleShape::Rock)
+                return Utils::Math::sweepCircle(start, delta, circleRadius, center, radius, time);
+
+            float tMin = 0.f;
+            float tMax = 1.f;
+            if (!Utils::Math::clipSegmentToBox(start, delta,
+                    center.x - halfSize.x - circleRadius, center.y - halfSize.y - circleRadius,
+                    center.x + halfSize.x + circleRadius, center.y + halfSize.y + circleRadius, tMin, tMax))
+                return false;
+
+            time = tMin;
+            return true;
+        }
+    };
+
+    /*
+     * STATIC WORLD GEOMETRY: Procedural obstacles per tile
+     * - Each generated tile gets a few rocks and walls, placed by a random
+     *   generator seeded from (world seed, tile x, tile y): a tile that unloads
+     *   and comes back looks exactly the same
+     * - Obstacles stay inside their tile (margin), so every obstacle belongs
+     *   to exactly one tile
+     * - Per tile, once at generation:
+     *   - StaticAABBTree over the obstacle boxes (collision queries)
+     *   - One vertex array with all obstacle triangles (one draw call per tile)
+     * - Both are dropped with the tile when it unloads
+     * - Dynamic colliders query the trees of the tiles under their box
+     *   (queryObstacles / sweepObstacles), static-vs-static is never tested
+     * - A safe zone (player spawn) is kept free of obstacles
+     */
     class WorldGenerator
     {
     public:
         WorldGenerator(float tileSize = 1000.f)
             : tileSize(tileSize)
             , renderDistance(2) // Render tiles 2 away from player
+            , seed(static_cast<uint32_t>(Utils::Random::range(0, 0x7FFFFFFF)))
+            , safeZoneCenter(0.f, 0.f)
+            , safeZoneRadius(0.f)
         {
             Utils::Logger::info("WorldGenerator initialized");
         }
 
+        // No obstacles are generated within 'radius' of 'center' (e.g. the player spawn)
+        // Affects tiles generated after the call
+        void setSafeZone(const sf::Vector2f& center, float radius)
+        {
+            safeZoneCenter = center;
+            safeZoneRadius = radius;
+        }
+
+        // Append obstacles whose bounds overlap the box (only loaded tiles)
+        // Read-only: safe to call from several threads
+        void queryObstacles(float minX, float minY, float maxX, float maxY,
+                            std::vector<const StaticObstacle*>& result) const
+        {
+            thread_local std::vector<uint32_t> hits;
+            forEachTile(minX, minY, maxX, maxY, [&](const Tile& tile) {
+                hits.clear();
+                tile.tree.query(minX, minY, maxX, maxY, hits);
+                for (uint32_t index : hits)
+                    result.push_back(&tile.obstacles[index]);
+            });
+        }
+
+        // Does a circle at 'position' overlap any obstacle (e.g. flow field cell test)
+        bool overlapsObstacle(const sf::Vector2f& position, float radius) const
+        {
+            thread_local std::vector<const StaticObstacle*> candidates;
+            candidates.clear();
+            queryObstacles(position.x - radius, position.y - radius, position.x + radius, position.y + radius, candidates);
+
+            sf::Vector2f correction;
+            for (const StaticObstacle* obstacle : candidates)
+            {
+                if (obstacle->pushOut(position, radius, correction))
+                    return true;
+            }
+            return false;
+        }
+
+        // Earliest obstacle hit of a circle moving start -> end
+        // Returns true and time (0..1 along the move) if something blocks it
+        bool sweepObstacles(const sf::Vector2f& start, const sf::Vector2f& end, float radius, float& time) const
+        {
+            thread_local std::vector<uint32_t> hits;
+            sf::Vector2f delta = end - start;
+            bool blocked = false;
+            time = 1.f;
+
+            forEachTile(std::min(start.x, end.x) - radius, std::min(start.y, end.y) - radius,
+                        std::max(start.x, end.x) + radius, std::max(start.y, end.y) + radius,
+                [&](const Tile& tile) {
+                    hits.clear();
+                    tile.tree.querySegment(start, end, radius, hits);
+                    for (uint32_t index : hits)
+                    {
+                        float hitTime;
+                        if (tile.obstacles[index].sweep(start, delta, radius, hitTime) && hitTime <= time)
+                        {
+                            time = hitTime;
+                            blocked = true;
+                        }
+                    }
+                });
+            return blocked;
+        }
+
         void update(const sf::Vector2f& playerPosition)
         {
             // Calculate which tile the player is currently in
@@ -59,7 +232,7 @@ namespace MediocreBONK::Systems
             }
 
             // Remove tiles that are too far from player
-            std::vector<TileKey> tilesToRemove;
+            auto tilesToRemove = Utils::makeFrameVector<TileKey>();
             for (const auto& [key, tile] : activeTiles)
             {
                 int distX = std::abs(key.x - playerTileX);
@@ -71,6 +244,7 @@ namespace MediocreBONK::Systems
                 }
             }
 
+            // Tile's obstacles and tree go with it
             for (const auto& key : tilesToRemove)
             {
                 activeTiles.erase(key);
@@ -81,13 +255,135 @@ namespace MediocreBONK::Systems
         {
             for (const auto& [key, tile] : activeTiles)
             {
-                window.draw(tile);
+                window.draw(tile.background);
+            }
+
+            // Obstacles after all backgrounds (neighbouring tiles would cover them)
+            for (const auto& [key, tile] : activeTiles)
+            {
+                if (tile.obstacleMesh.getVertexCount() > 0)
+                    window.draw(tile.obstacleMesh);
             }
         }
 
         float getTileSize() const { return tileSize; }
 
     private:
+        struct Tile
+        {
+            sf::RectangleShape background;
+            std::vector<StaticObstacle> obstacles;
+            Utils::StaticAABBTree tree;
+            sf::VertexArray obstacleMesh{ sf::PrimitiveType::Triangles };
+        };
+
+        // Visit the loaded tiles overlapping a box (usually 1, at most 4 for small boxes)
+        template<typename Function>
+        void forEachTile(float minX, float minY, float maxX, float maxY, Function fn) const
+        {
+            int firstX = static_cast<int>(std::floor(minX / tileSize));
+            int lastX = static_cast<int>(std::floor(maxX / tileSize));
+            int firstY = static_cast<int>(std::floor(minY / tileSize));
+            int lastY = static_cast<int>(std::floor(maxY / tileSize));
+
+            for (int x = firstX; x <= lastX; ++x)
+            {
+                for (int y = firstY; y <= lastY; ++y)
+                {
+                    auto it = activeTiles.find(TileKey{ x, y });
+                    if (it != activeTiles.end() && !it->second.tree.empty())
+                        fn(it->second);
+                }
+            }
+        }
+
+        void generateObstacles(const TileKey& key, Tile& tile)
+        {
+            static constexpr float Margin = 120.f; // > largest obstacle extent: stays inside the tile
+            static constexpr int MinObstacles = 3;
+            static constexpr int MaxObstacles = 7;
+
+            // Same tile -> same seed -> same obstacles every time it is generated
+            uint32_t tileSeed = seed;
+            tileSeed ^= static_cast<uint32_t>(key.x) * 0x9E3779B1u;
+            tileSeed ^= static_cast<uint32_t>(key.y) * 0x85EBCA77u;
+            std::mt19937 rng(tileSeed);
+            std::uniform_real_distribution<float> unit(0.f, 1.f);
+            auto range = [&](float min, float max) { return min + (max - min) * unit(rng); };
+
+            int count = MinObstacles + static_cast<int>(rng() % (MaxObstacles - MinObstacles + 1));
+            sf::Vector2f origin(key.x * tileSize, key.y * tileSize);
+
+            for (int i = 0; i < count; ++i)
+            {
+                StaticObstacle obstacle;
+                obstacle.center = origin + sf::Vector2f(range(Margin, tileSize - Margin), range(Margin, tileSize - Margin));
+                if (unit(rng) < 0.7f)
+                {
+                    obstacle.shape = ObstacleShape::Rock;
+                    obstacle.radius = range(25.f, 60.f);
+                    obstacle.halfSize = sf::Vector2f(obstacle.radius, obstacle.radius);
+                }
+                else
+                {
+                    // Long thin wall, horizontal or vertical
+                    obstacle.shape = ObstacleShape::Wall;
+                    obstacle.radius = 0.f;
+                    float length = range(40.f, 110.f);
+                    float thickness = range(12.f, 20.f);
+                    obstacle.halfSize = (rng() % 2 == 0) ? sf::Vector2f(length, thickness) : sf::Vector2f(thickness, length);
+                }
+
+                if (safeZoneRadius > 0.f)
+                {
+                    float clearance = safeZoneRadius + std::max(obstacle.halfSize.x, obstacle.halfSize.y);
+                    if (Utils::Math::distanceSquared(obstacle.center, safeZoneCenter) < clearance * clearance)
+                        continue;
+                }
+
+                tile.obstacles.push_back(obstacle);
+            }
+
+            std::vector<Utils::StaticAABBTree::Box> boxes;
+            boxes.reserve(tile.obstacles.size());
+            for (const auto& obstacle : tile.obstacles)
+            {
+                boxes.push_back(obstacle.getBounds());
+                appendMesh(obstacle, tile.obstacleMesh);
+            }
+            tile.tree.build(boxes);
+        }
+
+        // Obstacle triangles into the tile's vertex array (built once per tile)
+        static void appendMesh(const StaticObstacle& obstacle, sf::VertexArray& mesh)
+        {
+            static constexpr int RockSegments = 12;
+
+            if (obstacle.shape == ObstacleShape::Rock)
+            {
+                const sf::Color color(95, 90, 85);
+                for (int i = 0; i < RockSegments; ++i)
+                {
+                    float a0 = 2.f * 3.14159265f * i / RockSegments;
+                    float a1 = 2.f * 3.14159265f * (i + 1) / RockSegments;
+                    mesh.append(sf::Vertex{ obstacle.center, color });
+                    mesh.append(sf::Vertex{ obstacle.center + sf::Vector2f(std::cos(a0), std::sin(a0)) * obstacle.radius, color });
+                    mesh.append(sf::Vertex{ obstacle.center + sf::Vector2f(std::cos(a1), std::sin(a1)) * obstacle.radius, color });
+                }
+                return;
+            }
+
+            const sf::Color color(80, 80, 100);
+            sf::Vector2f min = obstacle.center - obstacle.halfSize;
+            sf::Vector2f max = obstacle.center + obstacle.halfSize;
+            mesh.append(sf::Vertex{ min, color });
+            mesh.append(sf::Vertex{ { max.x, min.y }, color });
+            mesh.append(sf::Vertex{ max, color });
+            mesh.append(sf::Vertex{ min, color });
+            mesh.append(sf::Vertex{ max, color });
+            mesh.append(sf::Vertex{ { min.x, max.y }, color });
+        }
+
         void generateTile(const TileKey& key)
         {
             sf::RectangleShape tile(sf::Vector2f(tileSize, tileSize));
@@ -109,11 +405,18 @@ namespace MediocreBONK::Systems
             tile.setOutlineThickness(2.f);
             tile.setOutlineColor(sf::Color(30, 30, 50, 100)); // Subtle outline
 
-            activeTiles[key] = tile;
+            Tile& newTile = activeTiles[key];
+            newTile.background = tile;
+            generateObstacles(key, newTile);
         }
 
         float tileSize;
         int renderDistance;
-        std::unordered_map<TileKey, sf::RectangleShape, TileKeyHash> activeTiles;
+        std::unordered_map<TileKey, Tile, TileKeyHash> activeTiles;
+
+        // Procedural obstacles
+        uint32_t seed;
+        sf::Vector2f safeZoneCenter;
+        float safeZoneRadius;
     };
 }
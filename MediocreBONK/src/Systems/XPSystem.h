@@ -3,12 +3,17 @@
 #include "../ECS/Components/Transform.h"
 #include "../ECS/Components/XPPickup.h"
 #include "../ECS/Components/Experience.h"
-#include "../ECS/Components/Experience.h"
 #include "../ECS/Components/Collider.h"
+#include "../ECS/Components/Sensor.h"
 #include "../ECS/Components/Buff.h"
 #include "../Utils/Math.h"
 #include "../Utils/Random.h"
+#include "ExpirySystem.h"
 #include <SFML/Graphics.hpp>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <cmath>
 
 namespace MediocreBONK::Systems
 {
@@ -18,129 +23,275 @@ namespace MediocreBONK::Systems
         XPSystem(ECS::EntityManager* entityManager, ECS::Entity* player)
             : entityManager(entityManager)
             , player(player)
-        {}
+            , magnetRange(100.f)
+            , pickupRange(30.f)
+            , magnet(nullptr)
+            , expirySystem(nullptr)
+        {
+            // Magnet radius = overlap-only sensor on the player, filled by CollisionSystem
+            magnet = player->addComponent<ECS::Components::Sensor>(
+                magnetRange, ECS::Components::Collider::layerBit(ECS::Components::CollisionLayer::Pickup));
+        }
+
+        // Gem lifetimes (without it gems never expire)
+        void setExpirySystem(ExpirySystem* system) { expirySystem = system; }
+
+        // Current magnet radius (base x MagnetRange buffs, as of the last update)
+        float getMagnetRadius() const { return magnet ? magnet->radius : magnetRange; }
 
         void update(sf::Time dt)
         {
-            // Handle XP pickup collection
-            collectXPPickups();
+            // Pull / collect the gems the magnet sensor reported this tick
+            collectXPPickups(dt.asSeconds());
         }
 
+        // One gem to drop (e.g. where an enemy died)
+        struct XPDropRequest
+        {
+            sf::Vector2f position;
+            float value;
+        };
+
         void spawnXPGem(const sf::Vector2f& position, float xpValue)
         {
-            // OPTIMIZATION: Check for nearby gems to merge with (reduces entity count)
-            const float MERGE_RADIUS = 25.f; // Merge gems within this radius
-            const float MERGE_RADIUS_SQUARED = MERGE_RADIUS * MERGE_RADIUS;
+            singleDrop.clear();
+            singleDrop.push_back({ position, xpValue });
+            spawnXPGems(singleDrop);
+        }
 
-            auto xpGems = entityManager->getEntitiesByTag("XPGem");
-            for (auto* existingGem : xpGems)
+        /*
+         * BATCHED XP DROPS (mass kills: one pass instead of one gem scan per death)
+         * - Existing gems are indexed ONCE per batch in a hash grid of MergeRadius cells
+         * - Each drop checks the 3x3 cells around it: merge into a gem within
+         *   MergeRadius (reduces entity count), else spawn a new gem (indexed
+         *   too, so later drops of the same batch can merge into it)
+         * - Gem cap: the furthest gems from the player are replaced, ordered once
+         *   per batch and only if the cap is actually reached
+         * - An evicted gem's slot is cleared at once: at the entity cap the next
+         *   createEntity() can hand the same (pooled) entity back, with a new
+         *   XPPickup, so neither isActive() nor the old pickup pointer can be trusted
+         */
+        void spawnXPGems(const std::vector<XPDropRequest>& drops)
+        {
+            if (drops.empty())
+                return;
+
+            // Index live gems
+            mergeCells.clear();
+            mergeSlots.clear();
+            for (auto* existingGem : entityManager->getEntitiesByTag("XPGem"))
             {
                 auto* existingTransform = existingGem->getComponent<ECS::Components::Transform>();
                 auto* existingPickup = existingGem->getComponent<ECS::Components::XPPickup>();
-
-                if (existingTransform && existingPickup)
-                {
-                    sf::Vector2f delta = existingTransform->position - position;
-                    float distSquared = delta.x * delta.x + delta.y * delta.y;
-
-                    if (distSquared <= MERGE_RADIUS_SQUARED)
-                    {
-                        // Merge into existing gem by increasing its value
-                        existingPickup->addValue(xpValue);
-                        return; // Don't spawn new gem, we merged instead
-                    }
-                }
+                if (existingGem->isActive() && existingTransform && existingPickup)
+                    indexGem(existingGem, existingPickup, existingTransform->position);
             }
 
-            // OPTIMIZATION: Cap max XP gems to prevent performance issues
-            const size_t MAX_XP_GEMS = 150;
-            if (xpGems.size() >= MAX_XP_GEMS)
+            size_t liveGems = mergeSlots.size();
+            evictionOrder.clear();
+            size_t nextEviction = 0;
+
+            for (const auto& drop : drops)
             {
-                // Find oldest gem (furthest from player) and replace it
-                auto* playerTransform = player->getComponent<ECS::Components::Transform>();
-                if (playerTransform)
+                // Merge into existing gem by increasing its value
+                if (auto* mergeTarget = findMergeTarget(drop.position))
                 {
-                    ECS::Entity* furthestGem = nullptr;
-                    float maxDistSquared = 0.f;
+                    mergeTarget->addValue(drop.value);
+                    continue;
+                }
 
-                    for (auto* gem : xpGems)
-                    {
-                        auto* gemTransform = gem->getComponent<ECS::Components::Transform>();
-                        if (gemTransform)
-                        {
-                            sf::Vector2f delta = gemTransform->position - playerTransform->position;
-                            float distSquared = delta.x * delta.x + delta.y * delta.y;
-
-                            if (distSquared > maxDistSquared)
-                            {
-                                maxDistSquared = distSquared;
-                                furthestGem = gem;
-                            }
-                        }
-                    }
+                // OPTIMIZATION: Cap max XP gems to prevent performance issues
+                if (liveGems >= MaxXPGems)
+                {
+                    // Replace the gems furthest from the player (ordered once per batch)
+                    if (evictionOrder.empty())
+                        buildEvictionOrder();
 
-                    if (furthestGem)
+                    while (nextEviction < evictionOrder.size() && !mergeSlots[evictionOrder[nextEviction].second].gem)
+                        ++nextEviction;
+                    if (nextEviction < evictionOrder.size())
                     {
-                        furthestGem->setActive(false);
+                        MergeSlot& evicted = mergeSlots[evictionOrder[nextEviction++].second];
+                        removeGem(evicted.gem);
+                        evicted.gem = nullptr; // No more merges into it
+                        evicted.pickup = nullptr;
+                        --liveGems;
                     }
                 }
-            }
 
-            auto* gem = entityManager->createEntity();
-            if (!gem)
-                return;
+                auto* gem = entityManager->createEntity();
+                if (!gem)
+                    return;
+
+                gem->tag = "XPGem";
+
+                // Add components
+                auto* transform = gem->addComponent<ECS::Components::Transform>(drop.position);
+                auto* xpPickup = gem->addComponent<ECS::Components::XPPickup>(drop.value, pickupRange);
+                auto* collider = gem->addComponent<ECS::Components::Collider>(ECS::Components::ColliderShape::Circle, 10.f);
+                collider->setLayer(ECS::Components::CollisionLayer::Pickup);
+                collider->isTrigger = true; // Only seen by sensors, never pushed around
 
-            gem->tag = "XPGem";
+                if (expirySystem)
+                    expirySystem->expireAfter(gem, GemLifetime);
 
-            // Add components
-            auto* transform = gem->addComponent<ECS::Components::Transform>(position);
-            auto* xpPickup = gem->addComponent<ECS::Components::XPPickup>(xpValue, player, 100.f, 30.f);
-            auto* collider = gem->addComponent<ECS::Components::Collider>(ECS::Components::ColliderShape::Circle, 10.f);
+                // Add some randomness to spawn position (scatter effect)
+                sf::Vector2f scatter = Utils::Random::insideCircle(10.f);
+                transform->position += scatter;
 
-            // Add some randomness to spawn position (scatter effect)
-            sf::Vector2f scatter = Utils::Random::insideCircle(10.f);
-            transform->position += scatter;
+                indexGem(gem, xpPickup, transform->position);
+                ++liveGems;
+            }
         }
 
     private:
-        void collectXPPickups()
+        // OPTIMIZATION: One batched sensor result instead of a distance check per gem
+        // - CollisionSystem already found the pickups near the player (one broadphase query)
+        // - Gems outside the magnet are never touched
+        void collectXPPickups(float deltaSeconds)
         {
             auto* playerTransform = player->getComponent<ECS::Components::Transform>();
             auto* playerExperience = player->getComponent<ECS::Components::Experience>();
 
-            if (!playerTransform || !playerExperience)
+            if (!playerTransform || !playerExperience || !magnet)
                 return;
 
-            auto xpGems = entityManager->getEntitiesByTag("XPGem");
+            auto* buff = player->getComponent<ECS::Components::Buff>();
+            float effectiveMagnetRange = magnetRange;
+            float xpMultiplier = 1.f;
+            if (buff)
+            {
+                effectiveMagnetRange *= buff->getBuffMultiplier(ECS::Components::BuffType::MagnetRange);
+                xpMultiplier = buff->getBuffMultiplier(ECS::Components::BuffType::XPMultiplier);
+            }
+            float magnetRangeSquared = effectiveMagnetRange * effectiveMagnetRange;
 
-            for (auto* gem : xpGems)
+            for (const auto& overlap : magnet->getOverlaps())
             {
-                auto* xpPickup = gem->getComponent<ECS::Components::XPPickup>();
+                ECS::Entity* gem = overlap.entity;
+                if (!gem->isActive())
+                    continue;
 
+                auto* xpPickup = gem->getComponent<ECS::Components::XPPickup>();
                 if (!xpPickup)
-                    continue;
+                    continue; // Power-ups share the pickup layer
 
-                // Check if gem is ready for pickup (distance already calculated in XPPickup::update)
-                if (xpPickup->isReadyForPickup())
+                // Same rules as before: gem center inside pickup / magnet range
+                float gemPickupRange = xpPickup->getPickupRange();
+                if (overlap.distanceSquared <= gemPickupRange * gemPickupRange)
                 {
-                    // Add XP to player
-                    float xpValue = xpPickup->getValue();
-                    auto* buff = player->getComponent<ECS::Components::Buff>();
-                    if (buff)
-                    {
-                        xpValue *= buff->getBuffMultiplier(ECS::Components::BuffType::XPMultiplier);
-                    }
-                    playerExperience->addXP(xpValue);
+                    playerExperience->addXP(xpPickup->getValue() * xpMultiplier);
 
                     // Deactivate gem
-                    gem->setActive(false);
+                    removeGem(gem);
 
                     // TODO: Play pickup sound/particle effect
                 }
+                else if (overlap.distanceSquared <= magnetRangeSquared)
+                {
+                    xpPickup->pullTowards(playerTransform->position, overlap.distanceSquared, deltaSeconds);
+                }
             }
+
+            // Follow magnet buffs (used by next tick's sensor pass)
+            magnet->radius = effectiveMagnetRange;
+        }
+
+        // Gem merge grid (rebuilt per spawnXPGems batch)
+        struct MergeSlot
+        {
+            ECS::Entity* gem;                     // nullptr once evicted in this batch
+            ECS::Components::XPPickup* pickup;
+            sf::Vector2f position;
+            int32_t next; // Next slot in the same cell, -1 = end
+        };
+
+        static constexpr float MergeRadius = 25.f; // Merge gems within this radius
+        static constexpr size_t MaxXPGems = 150;
+        static constexpr float GemLifetime = 40.f;  // Seconds before an uncollected gem disappears
+
+        // Collected or evicted: its expiry timer is no longer needed
+        void removeGem(ECS::Entity* gem)
+        {
+            if (expirySystem)
+                expirySystem->cancel(gem);
+            gem->setActive(false);
+        }
+
+        static uint64_t mergeCellKey(int64_t cellX, int64_t cellY)
+        {
+            return (static_cast<uint64_t>(cellY) << 32) ^ static_cast<uint64_t>(cellX & 0xFFFFFFFF);
+        }
+
+        static int64_t mergeCell(float coordinate)
+        {
+            return static_cast<int64_t>(std::floor(coordinate / MergeRadius));
+        }
+
+        void indexGem(ECS::Entity* gem, ECS::Components::XPPickup* pickup, const sf::Vector2f& position)
+        {
+            int32_t slot = static_cast<int32_t>(mergeSlots.size());
+            auto result = mergeCells.try_emplace(mergeCellKey(mergeCell(position.x), mergeCell(position.y)), slot);
+            int32_t next = -1;
+            if (!result.second)
+            {
+                next = result.first->second; // Prepend to the cell's list
+                result.first->second = slot;
+            }
+            mergeSlots.push_back({ gem, pickup, position, next });
+        }
+
+        ECS::Components::XPPickup* findMergeTarget(const sf::Vector2f& position) const
+        {
+            int64_t cellX = mergeCell(position.x);
+            int64_t cellY = mergeCell(position.y);
+            for (int64_t y = cellY - 1; y <= cellY + 1; ++y)
+            {
+                for (int64_t x = cellX - 1; x <= cellX + 1; ++x)
+                {
+                    auto it = mergeCells.find(mergeCellKey(x, y));
+                    if (it == mergeCells.end())
+                        continue;
+
+                    for (int32_t slot = it->second; slot != -1; slot = mergeSlots[slot].next)
+                    {
+                        const MergeSlot& candidate = mergeSlots[slot];
+                        if (candidate.gem &&
+                            Utils::Math::distanceSquared(candidate.position, position) <= MergeRadius * MergeRadius)
+                            return candidate.pickup;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        // Indexed gems, furthest from the player first
+        void buildEvictionOrder()
+        {
+            auto* playerTransform = player->getComponent<ECS::Components::Transform>();
+            if (!playerTransform)
+                return;
+
+            for (uint32_t slot = 0; slot < mergeSlots.size(); ++slot)
+            {
+                if (mergeSlots[slot].gem)
+                    evictionOrder.push_back({ Utils::Math::distanceSquared(mergeSlots[slot].position, playerTransform->position), slot });
+            }
+            std::sort(evictionOrder.begin(), evictionOrder.end(),
+                [](const auto& a, const auto& b) { return a.first > b.first; });
         }
 
         ECS::EntityManager* entityManager;
         ECS::Entity* player;
+        float magnetRange;  // Base magnet radius (scaled by BuffType::MagnetRange)
+        float pickupRange;  // Gem collected when its center is this close
+        ECS::Components::Sensor* magnet;
+        ExpirySystem* expirySystem;
+
+        // Batch buffers (reused)
+        std::vector<XPDropRequest> singleDrop;
+        std::unordered_map<uint64_t, int32_t> mergeCells; // Cell -> first slot
+        std::vector<MergeSlot> mergeSlots;
+        std::vector<std::pair<float, uint32_t>> evictionOrder; // Distance squared, merge slot
     };
 }
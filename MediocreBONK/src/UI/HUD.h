@@ -49,6 +49,11 @@ namespace MediocreBONK::UI
             killCount++;
         }
 
+        void addKillCount(int count)
+        {
+            killCount += count;
+        }
+
         float getGameTime() const { return gameTime; }
         int getKillCount() const { return killCount; }
 
@@ -0,0 +1,392 @@
+#pragma once
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include <utility>
+#include <functional>
+#include <SFML/System/Vector2.hpp>
+#include "../ECS/Entity.h"
+#include "Math.h"
+
+namespace MediocreBONK::Utils
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: PLUGGABLE BROADPHASE
+     *
+     * Problem:
+     * - Collision detection has two phases:
+     *   1. Broadphase: find pairs that MIGHT collide (cheap bounding box tests)
+     *   2. Narrowphase: test those pairs exactly (circle/rectangle math)
+     * - No single broadphase is best for every entity distribution:
+     *   - Tight horde around the player: many entities in few cells
+     *   - Sparse XP gems across the map: few entities in many cells
+     *
+     * Solution: One interface, several backends (Strategy pattern)
+     * - UniformGrid:   hash entities into fixed-size cells (SpatialGrid)
+     * - SweepAndPrune: keep entities sorted along X, sweep for overlaps
+     * - LooseQuadtree: hierarchy of grids, big entities live higher up
+     * - Backend can be swapped at runtime (see CollisionSystem::setBroadphase)
+     * - Every backend reports pair counts and timings per frame
+     *   so we can pick one from measurements instead of guesses
+     *
+     * Proxies:
+     * - Broadphase never touches components directly
+     * - CollisionSystem copies position/radius/bounds into a flat proxy array once per frame
+     * - Backends store proxy INDICES (uint32_t) instead of Entity pointers
+     * - Smaller, contiguous data = fewer cache misses during the sweep
+     *
+     * Usage:
+     *   broadphase->build(proxies);      // Once per frame
+     *   broadphase->findPairs(pairs);     // All overlapping AABB pairs (each pair once)
+     *   broadphase->query(pos, r, out);   // Proxies whose AABB overlaps a circle's AABB
+     *   broadphase->querySegment(a, b, r, out); // Proxies a moving circle passes (a -> b)
+     *   broadphase->queryNearest(pos, k, maxDist, out, filter); // k nearest, nearest first
+     */
+
+    // Snapshot of one collider for this frame
+    struct BroadphaseProxy
+    {
+        ECS::Entity* entity;
+        sf::Vector2f position;
+        float radius;
+
+        // Axis-aligned bounding box
+        float minX;
+        float minY;
+        float maxX;
+        float maxY;
+
+        // Collision layer index (bin used by LayeredBroadphase)
+        uint32_t layer = 0;
+
+        bool overlaps(const BroadphaseProxy& other) const
+        {
+            return minX <= other.maxX && maxX >= other.minX &&
+                   minY <= other.maxY && maxY >= other.minY;
+        }
+
+        bool overlaps(float otherMinX, float otherMinY, float otherMaxX, float otherMaxY) const
+        {
+            return minX <= otherMaxX && maxX >= otherMinX &&
+                   minY <= otherMaxY && maxY >= otherMinY;
+        }
+
+        // Does a circle of 'sweepRadius' moving start -> end touch this AABB?
+        // Slab test of the segment against the box grown by sweepRadius
+        bool overlapsSegment(const sf::Vector2f& start, const sf::Vector2f& end, float sweepRadius) const
+        {
+            float tMin = 0.f;
+            float tMax = 1.f;
+            return Math::clipSegmentToBox(start, end - start, minX - sweepRadius, minY - sweepRadius,
+                                          maxX + sweepRadius, maxY + sweepRadius, tMin, tMax);
+        }
+    };
+
+    // Candidate pair (indices into the proxy array, a < b)
+    struct BroadphasePair
+    {
+        uint32_t a;
+        uint32_t b;
+    };
+
+    // Result of a nearest-neighbour query
+    struct BroadphaseNeighbour
+    {
+        uint32_t index;          // Proxy index
+        float distanceSquared;   // From the query point to the proxy's position
+    };
+
+    // Optional predicate for nearest queries (e.g. tag, alive); empty = accept all
+    using ProxyFilter = std::function<bool(const BroadphaseProxy&)>;
+
+    /*
+     * k best neighbours seen so far, nearest first
+     * - k is small (1-8 targets): sorted insertion beats a heap
+     * - Candidates farther than the current k-th are rejected with one compare
+     *   on SQUARED distances (no sqrt anywhere)
+     * - Ties broken by proxy index: same result whatever the visiting order
+     */
+    class NearestCollector
+    {
+    public:
+        NearestCollector(size_t k, float maxDistanceSquared, std::vector<BroadphaseNeighbour>& result)
+            : k(k)
+            , maxDistanceSquared(maxDistanceSquared)
+            , result(result)
+        {
+            result.clear();
+        }
+
+        void offer(uint32_t index, float distanceSquared)
+        {
+            if (k == 0 || distanceSquared > maxDistanceSquared)
+                return;
+            if (full() && !closer(distanceSquared, index, result.back()))
+                return;
+
+            auto it = std::upper_bound(result.begin(), result.end(), BroadphaseNeighbour{ index, distanceSquared },
+                [](const BroadphaseNeighbour& x, const BroadphaseNeighbour& y) {
+                    return closer(x.distanceSquared, x.index, y);
+                });
+            result.insert(it, { index, distanceSquared });
+            if (result.size() > k)
+                result.pop_back();
+        }
+
+        bool full() const { return result.size() >= k; }
+
+        // Search can stop once nothing left can beat this (squared)
+        float worstDistanceSquared() const
+        {
+            return full() ? result.back().distanceSquared : maxDistanceSquared;
+        }
+
+        void reset() { result.clear(); }
+
+    private:
+        static bool closer(float distanceSquared, uint32_t index, const BroadphaseNeighbour& other)
+        {
+            return distanceSquared != other.distanceSquared ? distanceSquared < other.distanceSquared
+                                                            : index < other.index;
+        }
+
+        size_t k;
+        float maxDistanceSquared;
+        std::vector<BroadphaseNeighbour>& result;
+    };
+
+    // Per-frame measurements (reset on every build)
+    struct BroadphaseStats
+    {
+        size_t proxyCount = 0;
+        size_t pairCount = 0;
+        size_t queryCount = 0;
+        long long buildMicros = 0;
+        long long pairMicros = 0;
+    };
+
+    enum class BroadphaseType
+    {
+        UniformGrid,
+        SweepAndPrune,
+        LooseQuadtree
+    };
+
+    /*
+     * DESIGN PATTERN: TEMPLATE METHOD (Non-Virtual Interface)
+     * - Public build()/findPairs()/query() are non-virtual: they time/count the work
+     * - Backends override only the protected onBuild()/onFindPairs()/onQuery() hooks
+     * - Guarantees every backend is measured the same way
+     */
+    class Broadphase
+    {
+    public:
+        virtual ~Broadphase() = default;
+
+        // Rebuild acceleration structure from this frame's proxies
+        // Proxy array must stay alive (and unchanged) until the next build
+        void build(const std::vector<BroadphaseProxy>& proxyList)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            proxies = &proxyList;
+            stats = BroadphaseStats();
+            stats.proxyCount = proxyList.size();
+            computeBounds();
+            onBuild();
+
+            stats.buildMicros = elapsedMicros(start);
+        }
+
+        // Append every pair whose AABBs overlap (each pair reported once)
+        void findPairs(std::vector<BroadphasePair>& pairs)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            size_t before = pairs.size();
+            onFindPairs(pairs);
+
+            stats.pairCount += pairs.size() - before;
+            stats.pairMicros += elapsedMicros(start);
+        }
+
+        // SPATIAL QUERY: Append proxies whose AABB overlaps the circle's AABB
+        // Each proxy appears at most once
+        void query(const sf::Vector2f& position, float radius, std::vector<uint32_t>& result)
+        {
+            queryBox(position.x - radius, position.y - radius, position.x + radius, position.y + radius, result);
+        }
+
+        // Same as query() with an explicit box
+        void queryBox(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& result)
+        {
+            stats.queryCount++;
+            onQuery(minX, minY, maxX, maxY, result);
+        }
+
+        // THREAD SAFETY: Queries only read the structure built by build(),
+        // so several worker threads may call this at once (not counted in stats)
+        void queryBoxConcurrent(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& result) const
+        {
+            onQuery(minX, minY, maxX, maxY, result);
+        }
+
+        // SWEPT QUERY: Append proxies whose AABB a circle of 'radius' touches
+        // while moving from start to end (continuous collision candidates)
+        // Each proxy appears at most once, order is unspecified
+        void querySegment(const sf::Vector2f& start, const sf::Vector2f& end, float radius, std::vector<uint32_t>& result)
+        {
+            stats.queryCount++;
+            onQuerySegment(start, end, radius, result);
+        }
+
+        // Thread-safe variant (see queryBoxConcurrent), count with addQueryCount()
+        void querySegmentConcurrent(const sf::Vector2f& start, const sf::Vector2f& end, float radius, std::vector<uint32_t>& result) const
+        {
+            onQuerySegment(start, end, radius, result);
+        }
+
+        // NEAREST NEIGHBOURS: Replace 'result' with the k proxies closest to 'position'
+        // (by proxy position, nearest first) within maxDistance that pass 'filter'
+        void queryNearest(const sf::Vector2f& position, size_t k, float maxDistance,
+                          std::vector<BroadphaseNeighbour>& result, const ProxyFilter& filter = nullptr)
+        {
+            stats.queryCount++;
+            onQueryNearest(position, k, maxDistance, result, filter);
+        }
+
+        // Thread-safe variant (see queryBoxConcurrent)
+        void queryNearestConcurrent(const sf::Vector2f& position, size_t k, float maxDistance,
+                                    std::vector<BroadphaseNeighbour>& result, const ProxyFilter& filter = nullptr) const
+        {
+            onQueryNearest(position, k, maxDistance, result, filter);
+        }
+
+        // Account for a batch of concurrent queries (call from one thread)
+        void addQueryCount(size_t count) { stats.queryCount += count; }
+
+        virtual const char* getName() const = 0;
+
+        const BroadphaseStats& getStats() const { return stats; }
+
+    protected:
+        virtual void onBuild() = 0;
+        virtual void onFindPairs(std::vector<BroadphasePair>& pairs) = 0;
+        // Must not modify the backend (called concurrently by queryBoxConcurrent)
+        virtual void onQuery(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& result) const = 0;
+
+        // Default: query the segment's bounding box, keep proxies the swept circle touches
+        // (fine for short segments; SpatialGrid walks the cells along the segment instead)
+        virtual void onQuerySegment(const sf::Vector2f& start, const sf::Vector2f& end, float radius,
+                                    std::vector<uint32_t>& result) const
+        {
+            size_t first = result.size();
+            onQuery(std::min(start.x, end.x) - radius, std::min(start.y, end.y) - radius,
+                    std::max(start.x, end.x) + radius, std::max(start.y, end.y) + radius, result);
+
+            const auto& list = *proxies;
+            auto kept = std::remove_if(result.begin() + first, result.end(), [&](uint32_t index) {
+                return !list[index].overlapsSegment(start, end, radius);
+            });
+            result.erase(kept, result.end());
+        }
+
+        /*
+         * Default nearest search: EXPANDING BOX
+         * - Query a box of half-size R around the point, keep the k nearest
+         * - Done when k were found within R (anything outside the box is farther
+         *   than R), or the box covers every proxy / maxDistance
+         * - Otherwise double R and query again (total work stays ~ the last query)
+         * SpatialGrid overrides this with a ring-by-ring cell search
+         */
+        virtual void onQueryNearest(const sf::Vector2f& position, size_t k, float maxDistance,
+                                    std::vector<BroadphaseNeighbour>& result, const ProxyFilter& filter) const
+        {
+            NearestCollector collector(k, maxDistance * maxDistance, result);
+            if (k == 0 || proxies->empty())
+                return;
+
+            thread_local std::vector<uint32_t> candidates;
+            const auto& list = *proxies;
+            float radius = InitialNearestRadius;
+
+            while (true)
+            {
+                collector.reset(); // Box grows over the previous one: rescan all
+                candidates.clear();
+                onQuery(position.x - radius, position.y - radius, position.x + radius, position.y + radius, candidates);
+
+                for (uint32_t index : candidates)
+                {
+                    const BroadphaseProxy& proxy = list[index];
+                    float dx = proxy.position.x - position.x;
+                    float dy = proxy.position.y - position.y;
+                    float distanceSquared = dx * dx + dy * dy;
+                    if (distanceSquared <= radius * radius && (!filter || filter(proxy)))
+                        collector.offer(index, distanceSquared);
+                }
+
+                bool coversAll = position.x - radius <= bounds.minX && position.y - radius <= bounds.minY &&
+                                 position.x + radius >= bounds.maxX && position.y + radius >= bounds.maxY;
+                if ((collector.full() && collector.worstDistanceSquared() <= radius * radius) ||
+                    radius >= maxDistance || coversAll)
+                {
+                    // Final pass: the whole box is known, take the corners too
+                    if (!collector.full() || collector.worstDistanceSquared() > radius * radius)
+                    {
+                        collector.reset();
+                        for (uint32_t index : candidates)
+                        {
+                            const BroadphaseProxy& proxy = list[index];
+                            float dx = proxy.position.x - position.x;
+                            float dy = proxy.position.y - position.y;
+                            if (!filter || filter(proxy))
+                                collector.offer(index, dx * dx + dy * dy);
+                        }
+                    }
+                    return;
+                }
+                radius *= 2.f;
+            }
+        }
+
+        static constexpr float InitialNearestRadius = 128.f;
+
+        static long long elapsedMicros(std::chrono::high_resolution_clock::time_point start)
+        {
+            auto end = std::chrono::high_resolution_clock::now();
+            return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        }
+
+        // AABB around every proxy of this build (empty: min > max)
+        struct Bounds
+        {
+            float minX = 0.f;
+            float minY = 0.f;
+            float maxX = -1.f;
+            float maxY = -1.f;
+        };
+
+        const std::vector<BroadphaseProxy>* proxies = nullptr;
+        BroadphaseStats stats;
+        Bounds bounds;
+
+    private:
+        void computeBounds()
+        {
+            bounds = Bounds();
+            if (proxies->empty())
+                return;
+
+            bounds = { (*proxies)[0].minX, (*proxies)[0].minY, (*proxies)[0].maxX, (*proxies)[0].maxY };
+            for (const auto& proxy : *proxies)
+            {
+                bounds.minX = std::min(bounds.minX, proxy.minX);
+                bounds.minY = std::min(bounds.minY, proxy.minY);
+                bounds.maxX = std::max(bounds.maxX, proxy.maxX);
+                bounds.maxY = std::max(bounds.maxY, proxy.maxY);
+            }
+        }
+    };
+}
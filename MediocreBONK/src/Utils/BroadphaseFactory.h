@@ -0,0 +1,42 @@
+#pragma once
+#include "Broadphase.h"
+#include "SpatialGrid.h"
+#include "SweepAndPrune.h"
+#include "LooseQuadtree.h"
+#include <memory>
+
+namespace MediocreBONK::Utils
+{
+    // Factory for creating broadphase backends by type
+    class BroadphaseFactory
+    {
+    public:
+        static std::unique_ptr<Broadphase> create(BroadphaseType type)
+        {
+            switch (type)
+            {
+            case BroadphaseType::SweepAndPrune:
+                return std::make_unique<SweepAndPrune>();
+            case BroadphaseType::LooseQuadtree:
+                return std::make_unique<LooseQuadtree>();
+            case BroadphaseType::UniformGrid:
+            default:
+                return std::make_unique<SpatialGrid>(100.f); // Cell size 100
+            }
+        }
+
+        static const char* getName(BroadphaseType type)
+        {
+            switch (type)
+            {
+            case BroadphaseType::UniformGrid:
+                return "Uniform Grid";
+            case BroadphaseType::SweepAndPrune:
+                return "Sweep and Prune";
+            case BroadphaseType::LooseQuadtree:
+                return "Loose Quadtree";
+            }
+            return "Unknown";
+        }
+    };
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+namespace MediocreBONK::Utils
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: LAYER COLLISION MATRIX
+     *
+     * Problem:
+     * - Collider::layer/mask were only checked inside intersects(),
+     *   AFTER the broadphase found the pair and both colliders were fetched
+     * - Most pairs the broadphase finds can never interact:
+     *   XP gem vs enemy, bullet vs bullet, gem vs gem...
+     *
+     * Solution: Symmetric layer x layer bit matrix
+     * - rows[a] bit b set = layer a interacts with layer b
+     * - LayeredBroadphase bins proxies per layer and only visits bin pairs
+     *   the matrix allows, so impossible pairs are never even generated
+     * - Up to 32 layers (one uint32_t row per layer)
+     *
+     * Usage:
+     *   matrix.set(PlayerProjectileLayer, EnemyLayer, true);
+     *   if (matrix.canCollide(a, b)) ...
+     */
+    class CollisionMatrix
+    {
+    public:
+        static constexpr uint32_t MaxLayers = 32;
+
+        CollisionMatrix()
+        {
+            rows.fill(0);
+        }
+
+        // Enable/disable interaction between two layers (symmetric)
+        void set(uint32_t layerA, uint32_t layerB, bool collide)
+        {
+            if (layerA >= MaxLayers || layerB >= MaxLayers)
+                return;
+
+            if (collide)
+            {
+                rows[layerA] |= (1u << layerB);
+                rows[layerB] |= (1u << layerA);
+            }
+            else
+            {
+                rows[layerA] &= ~(1u << layerB);
+                rows[layerB] &= ~(1u << layerA);
+            }
+        }
+
+        // Layer interacts with every layer (e.g. a "Default" catch-all layer)
+        void setAll(uint32_t layer, bool collide)
+        {
+            for (uint32_t other = 0; other < MaxLayers; ++other)
+                set(layer, other, collide);
+        }
+
+        bool canCollide(uint32_t layerA, uint32_t layerB) const
+        {
+            if (layerA >= MaxLayers || layerB >= MaxLayers)
+                return false;
+            return (rows[layerA] & (1u << layerB)) != 0;
+        }
+
+        // Bit mask of all layers this layer interacts with
+        uint32_t getMask(uint32_t layer) const
+        {
+            return layer < MaxLayers ? rows[layer] : 0;
+        }
+
+        void clear()
+        {
+            rows.fill(0);
+        }
+
+    private:
+        std::array<uint32_t, MaxLayers> rows;
+    };
+}
@@ -0,0 +1,121 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+
+namespace MediocreBONK::Utils
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: PERSISTENT CONTACT CACHE (Temporal Coherence)
+     *
+     * Problem:
+     * - Collision detection is stateless: it only knows "A and B overlap NOW"
+     * - onCollisionEnter fired EVERY frame two colliders overlapped
+     *   (a player standing on a power-up = 60 callbacks per second)
+     * - onCollisionExit could never fire: nobody remembered the previous frame
+     *
+     * Solution: Remember last frame's contacts
+     * - Hash map keyed by the pair of entity IDs (smaller ID first)
+     * - Each frame, every detected contact is touch()ed:
+     *   - Not in the map -> ENTER (inserted)
+     *   - Already there  -> STAY  (frame stamp refreshed)
+     * - endFrame(): entries not touched this frame -> EXIT (removed)
+     * - Contacts persist across frames, so gameplay callbacks run once per contact
+     *
+     * Why IDs instead of Entity pointers?
+     * - Entities can be cleaned up between frames; a stale pointer in the
+     *   cache would be dangerous on exit. IDs are resolved through
+     *   EntityManager::getEntity() (O(1)) when the exit is delivered.
+     *
+     * Usage:
+     *   cache.beginFrame();
+     *   for (contact : contacts)
+     *       if (cache.touch(idA, idB)) { enter } else { stay }
+     *   cache.endFrame();
+     *   for (key : cache.getExited()) { exit }
+     */
+    class ContactCache
+    {
+    public:
+        struct ContactKey
+        {
+            uint64_t a; // Smaller entity ID
+            uint64_t b; // Larger entity ID
+
+            bool operator==(const ContactKey& other) const { return a == other.a && b == other.b; }
+            bool operator<(const ContactKey& other) const { return a != other.a ? a < other.a : b < other.b; }
+        };
+
+        ContactCache()
+            : frame(0)
+        {}
+
+        void beginFrame()
+        {
+            ++frame;
+            exited.clear();
+        }
+
+        // Record a contact for this frame, returns true if it just started (enter)
+        bool touch(uint64_t idA, uint64_t idB)
+        {
+            ContactKey key = makeKey(idA, idB);
+            auto result = contacts.try_emplace(key, frame);
+            if (!result.second)
+                result.first->second = frame; // Stay
+            return result.second;
+        }
+
+        // Contacts not touched since beginFrame() become exits
+        void endFrame()
+        {
+            for (auto it = contacts.begin(); it != contacts.end();)
+            {
+                if (it->second != frame)
+                {
+                    exited.push_back(it->first);
+                    it = contacts.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            // Deterministic delivery order (hash map order is arbitrary)
+            std::sort(exited.begin(), exited.end());
+        }
+
+        const std::vector<ContactKey>& getExited() const { return exited; }
+        size_t size() const { return contacts.size(); }
+
+        void clear()
+        {
+            contacts.clear();
+            exited.clear();
+        }
+
+        static ContactKey makeKey(uint64_t idA, uint64_t idB)
+        {
+            return idA < idB ? ContactKey{ idA, idB } : ContactKey{ idB, idA };
+        }
+
+    private:
+        struct ContactKeyHash
+        {
+            size_t operator()(const ContactKey& key) const
+            {
+                // Mix both IDs (64-bit multiplicative hash)
+                uint64_t h = key.a * 0x9E3779B97F4A7C15ull;
+                h ^= key.b + 0x7F4A7C159E3779B9ull + (h << 6) + (h >> 2);
+                return static_cast<size_t>(h);
+            }
+        };
+
+        // Contact -> frame it was last seen
+        std::unordered_map<ContactKey, uint64_t, ContactKeyHash> contacts;
+        std::vector<ContactKey> exited;
+        uint64_t frame;
+    };
+}
@@ -0,0 +1,156 @@
+#pragma once
+#include "Profiler.h"
+#include <memory_resource>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace MediocreBONK::Utils
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: PER-FRAME LINEAR (BUMP) ALLOCATOR
+     *
+     * Problem:
+     * - Every frame built throw-away vectors: ECS query results
+     *   (getEntitiesWithComponents), tiles to unload, ...
+     * - Each one = malloc + free, every frame, for data that dies a few lines later
+     *
+     * Solution: One arena, rewound once per frame
+     * - allocate = align + bump an offset (no headers, no free lists, no locks)
+     * - deallocate = nothing; reset() at the start of the frame frees everything
+     * - Exposed as a std::pmr::memory_resource: any pmr container can use it
+     *   (FrameVector<T> below)
+     * - Overflow: extra chunks are chained for the rest of the frame, then
+     *   merged into one bigger block at the next reset() (grows to the peak once)
+     *
+     * Rules:
+     * - Frame memory is valid until the next reset() (start of the next frame):
+     *   never keep a FrameVector in a member or a static
+     * - Main thread only (no locking): worker tasks use their per-worker scratch
+     * - Prefer reserve(): a growing pmr vector leaves its old buffers in the
+     *   arena until the end of the frame
+     *
+     * Usage:
+     *   auto tiles = Utils::makeFrameVector<TileKey>();   // Bound to the frame arena
+     *   tiles.push_back(key);                              // Pointer bump, no free
+     */
+    class FrameArena : public std::pmr::memory_resource
+    {
+    public:
+        // SINGLETON PATTERN: One arena, reset by the game loop
+        static FrameArena& getInstance()
+        {
+            static FrameArena instance;
+            return instance;
+        }
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        // Start of frame: everything allocated last frame is released at once
+        void reset()
+        {
+            Profiler::record("Frame Arena Bytes", static_cast<long long>(usedBytes));
+
+            if (chunks.size() > 1)
+            {
+                // Last frame overflowed: one block big enough for it from now on
+                size_t total = 0;
+                for (const auto& chunk : chunks)
+                    total += chunk.size;
+                chunks.clear();
+                addChunk(total);
+            }
+
+            chunks.front().offset = 0;
+            current = 0;
+            usedBytes = 0;
+        }
+
+        size_t getUsedBytes() const { return usedBytes; }
+
+        size_t getCapacity() const
+        {
+            size_t total = 0;
+            for (const auto& chunk : chunks)
+                total += chunk.size;
+            return total;
+        }
+
+    private:
+        struct Chunk
+        {
+            std::unique_ptr<std::byte[]> memory;
+            size_t size = 0;
+            size_t offset = 0;
+        };
+
+        static constexpr size_t DefaultCapacity = 1 << 20; // 1 MB
+
+        FrameArena()
+            : current(0)
+            , usedBytes(0)
+        {
+            addChunk(DefaultCapacity);
+        }
+
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            if (void* memory = bump(chunks[current], bytes, alignment))
+                return memory;
+
+            // Overflow: chain a new chunk (at least as big as the last one)
+            addChunk(std::max(chunks.back().size, bytes + alignment));
+            current = chunks.size() - 1;
+            return bump(chunks[current], bytes, alignment);
+        }
+
+        // Freed all at once by reset()
+        void do_deallocate(void*, size_t, size_t) override {}
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        void* bump(Chunk& chunk, size_t bytes, size_t alignment)
+        {
+            auto base = reinterpret_cast<std::uintptr_t>(chunk.memory.get());
+            std::uintptr_t aligned = (base + chunk.offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+            size_t end = static_cast<size_t>(aligned - base) + bytes;
+            if (end > chunk.size)
+                return nullptr;
+
+            usedBytes += end - chunk.offset;
+            chunk.offset = end;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        void addChunk(size_t size)
+        {
+            Chunk chunk;
+            chunk.memory = std::make_unique<std::byte[]>(size);
+            chunk.size = size;
+            chunks.push_back(std::move(chunk));
+        }
+
+        std::vector<Chunk> chunks; // chunks[0] is the main block, others only during an overflowing frame
+        size_t current;            // Chunk being bumped
+        size_t usedBytes;          // This frame (including alignment padding)
+    };
+
+    // Scratch containers living in the frame arena (valid until the next frame)
+    template<typename T>
+    using FrameVector = std::pmr::vector<T>;
+
+    template<typename T>
+    FrameVector<T> makeFrameVector(size_t reserve = 0)
+    {
+        FrameVector<T> result(&FrameArena::getInstance());
+        if (reserve > 0)
+            result.reserve(reserve);
+        return result;
+    }
+}
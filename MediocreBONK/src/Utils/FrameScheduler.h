@@ -0,0 +1,216 @@
+#pragma once
+#include "Profiler.h"
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+
+namespace MediocreBONK::Utils
+{
+    // Identifies one registered job (index into the scheduler's job list)
+    using JobId = uint32_t;
+
+    /*
+     * OPTIMIZATION TECHNIQUE: FREQUENCY-STAGGERED SCHEDULING
+     *
+     * Problem:
+     * - Periodic work ran on ad-hoc float timers, all started at 0:
+     *   entity cleanup (0.5s), enemy culling (1s), spawn waves, the perf dump (5s)
+     * - Their periods are multiples of each other: every second the cleanup,
+     *   the cull and a wave landed in the SAME tick -> sawtooth frame times
+     *
+     * Solution: Systems declare a period + cost, the scheduler picks the ticks
+     * - Time is counted in update ticks (fixed 60 Hz, see Game)
+     * - Phase assignment: a job with period P may run on any tick offset
+     *   0..P-1; add() tries every offset against a load table (cost already
+     *   booked per tick over one hyperperiod) and keeps the one with the lowest
+     *   peak -> heavy jobs never share a tick if they can avoid it
+     * - Heaviest jobs are placed first (rebalance()), cheap ones fill the gaps
+     * - Amortisation: a job with 'slices' > 1 runs on that many consecutive
+     *   ticks, each call gets (slice, sliceCount) and does its share of the work
+     *   (e.g. culls 1/4 of the enemies) - its cost is booked per slice
+     *
+     * Load table horizon = LCM of the periods, capped at MaxHorizonTicks
+     * (periods that don't divide the cap are approximated, placement stays good)
+     *
+     * Usage:
+     *   Utils::FrameScheduler scheduler;
+     *   scheduler.add("Enemy Cull", 1.f, 200.f,
+     *       [this](uint32_t slice, uint32_t count) { cull(slice, count); }, 4);
+     *   scheduler.tick(); // Once per update
+     */
+    class FrameScheduler
+    {
+    public:
+        // Called with the slice to run (0..sliceCount-1)
+        using JobFunction = std::function<void(uint32_t slice, uint32_t sliceCount)>;
+
+        static constexpr uint32_t MaxHorizonTicks = 3600; // 60 s at 60 Hz
+
+        explicit FrameScheduler(float tickSeconds = 1.f / 60.f)
+            : tickSeconds(tickSeconds)
+            , currentTick(0)
+            , horizon(1)
+        {}
+
+        // periodSeconds: how often the whole job runs
+        // cost: estimated cost of one full run (any unit, only compared between jobs)
+        // slices: number of ticks the job is spread over (clamped to the period)
+        JobId add(const std::string& name, float periodSeconds, float cost, JobFunction function, uint32_t slices = 1)
+        {
+            Job job;
+            job.name = name;
+            job.function = std::move(function);
+            job.cost = std::max(cost, 0.f);
+            job.period = toTicks(periodSeconds);
+            job.slices = std::clamp<uint32_t>(slices, 1, job.period);
+            jobs.push_back(std::move(job));
+
+            rebalance();
+            return static_cast<JobId>(jobs.size() - 1);
+        }
+
+        // Change a job's frequency (e.g. spawn interval scaled by difficulty)
+        // Only re-plans when the period in ticks actually changes
+        void setPeriod(JobId id, float periodSeconds)
+        {
+            Job& job = jobs[id];
+            uint32_t period = toTicks(periodSeconds);
+            if (period == job.period)
+                return;
+
+            job.period = period;
+            job.slices = std::min(job.slices, period);
+            rebalance();
+        }
+
+        void setEnabled(JobId id, bool enabled) { jobs[id].enabled = enabled; }
+
+        // Run every job slice due on this tick
+        void tick()
+        {
+            for (Job& job : jobs)
+            {
+                if (!job.enabled)
+                    continue;
+
+                uint32_t local = static_cast<uint32_t>((currentTick + job.period - job.phase) % job.period);
+                if (local >= job.slices)
+                    continue;
+
+                Profiler::start(job.name);
+                job.function(local, job.slices);
+                Profiler::stop(job.name);
+            }
+            ++currentTick;
+        }
+
+        // Re-plan every phase from scratch: heaviest cost per slice first
+        void rebalance()
+        {
+            horizon = 1;
+            for (const Job& job : jobs)
+                horizon = std::min<uint64_t>(std::lcm<uint64_t>(horizon, job.period), MaxHorizonTicks);
+            load.assign(static_cast<size_t>(horizon), 0.f);
+
+            order.resize(jobs.size());
+            std::iota(order.begin(), order.end(), 0u);
+            std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+                return jobs[a].sliceCost() > jobs[b].sliceCost();
+            });
+
+            for (uint32_t index : order)
+                place(jobs[index]);
+        }
+
+        // Highest booked cost of any tick (after placement)
+        float getPeakLoad() const
+        {
+            return load.empty() ? 0.f : *std::max_element(load.begin(), load.end());
+        }
+
+        size_t getJobCount() const { return jobs.size(); }
+
+        void clear()
+        {
+            jobs.clear();
+            load.clear();
+            order.clear();
+            currentTick = 0;
+            horizon = 1;
+        }
+
+    private:
+        struct Job
+        {
+            std::string name;
+            JobFunction function;
+            float cost = 0.f;
+            uint32_t period = 1;   // Ticks
+            uint32_t slices = 1;
+            uint32_t phase = 0;    // Tick offset of slice 0
+            bool enabled = true;
+
+            float sliceCost() const { return cost / static_cast<float>(slices); }
+        };
+
+        uint32_t toTicks(float seconds) const
+        {
+            return std::max<uint32_t>(1, static_cast<uint32_t>(std::lround(seconds / tickSeconds)));
+        }
+
+        // Book the job on the offset whose busiest tick ends up lowest
+        // (ties: lowest total of its ticks, then earliest offset)
+        void place(Job& job)
+        {
+            float sliceCost = job.sliceCost();
+            float bestPeak = 0.f;
+            float bestSum = 0.f;
+            uint32_t bestPhase = 0;
+            bool found = false;
+
+            for (uint32_t phase = 0; phase < job.period; ++phase)
+            {
+                float peak = 0.f;
+                float sum = 0.f;
+                forEachTick(job, phase, [&](size_t t) {
+                    peak = std::max(peak, load[t]);
+                    sum += load[t];
+                });
+
+                if (!found || peak < bestPeak || (peak == bestPeak && sum < bestSum))
+                {
+                    bestPeak = peak;
+                    bestSum = sum;
+                    bestPhase = phase;
+                    found = true;
+                }
+            }
+
+            job.phase = bestPhase;
+            forEachTick(job, bestPhase, [&](size_t t) { load[t] += sliceCost; });
+        }
+
+        // Every load-table tick the job's slices occupy with 'phase'
+        template<typename Visitor>
+        void forEachTick(const Job& job, uint32_t phase, Visitor&& visit) const
+        {
+            for (uint64_t start = phase % horizon; start < horizon; start += job.period)
+            {
+                for (uint32_t slice = 0; slice < job.slices; ++slice)
+                    visit(static_cast<size_t>((start + slice) % horizon));
+            }
+        }
+
+        float tickSeconds;
+        uint64_t currentTick;
+        uint64_t horizon;           // Length of the load table (ticks)
+
+        std::vector<Job> jobs;
+        std::vector<float> load;    // Booked cost per tick of the horizon
+        std::vector<uint32_t> order; // Placement order (reused)
+    };
+}
@@ -0,0 +1,277 @@
+#pragma once
+#include <vector>
+#include <array>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include "Broadphase.h"
+#include "BroadphaseFactory.h"
+#include "CollisionMatrix.h"
+#include "ThreadPool.h"
+
+namespace MediocreBONK::Utils
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: PER-LAYER BROADPHASE BINS
+     *
+     * Problem:
+     * - A single broadphase reports every overlapping pair, including pairs
+     *   the layer matrix forbids (bullet vs bullet, gem vs enemy)
+     * - In a horde, enemies sit on top of XP gems: thousands of useless pairs
+     *   that are generated, classified and thrown away every frame
+     *
+     * Solution: One backend per layer, matrix decides which bins meet
+     * - build(): proxies are split into bins by BroadphaseProxy::layer,
+     *   each non-empty bin builds its own backend (grid / SAP / quadtree)
+     * - findPairs():
+     *   - Same layer (matrix[a][a]): the bin's own findPairs()
+     *   - Layer a vs layer b (matrix[a][b]): every proxy of the SMALLER bin
+     *     queries the LARGER bin's backend (e.g. 1 player vs 2000 enemies = 1 query)
+     *   - Forbidden bin pairs are never visited at all
+     * - Candidate pairs now scale with pairs that can actually interact
+     *
+     * Indices:
+     * - Backends see bin-local indices; results are mapped back to the
+     *   caller's proxy array so the interface is unchanged (pair.a < pair.b)
+     */
+    class LayeredBroadphase : public Broadphase
+    {
+    public:
+        LayeredBroadphase(BroadphaseType type, const CollisionMatrix* matrix)
+            : type(type)
+            , matrix(matrix)
+        {}
+
+        const char* getName() const override { return BroadphaseFactory::getName(type); }
+
+        BroadphaseType getType() const { return type; }
+
+        // SPATIAL QUERY restricted to some layers (bit mask of layer indices)
+        void queryLayers(const sf::Vector2f& position, float radius, uint32_t layerMask, std::vector<uint32_t>& result)
+        {
+            stats.queryCount++;
+            queryBins(position.x - radius, position.y - radius, position.x + radius, position.y + radius, layerMask, result);
+        }
+
+        // SWEPT QUERY restricted to some layers, thread-safe (count with addQueryCount())
+        void querySegmentLayersConcurrent(const sf::Vector2f& start, const sf::Vector2f& end, float radius,
+                                          uint32_t layerMask, std::vector<uint32_t>& result) const
+        {
+            sweepBins(start, end, radius, layerMask, result);
+        }
+
+        // NEAREST NEIGHBOURS restricted to some layers (e.g. enemies only)
+        void queryNearestLayers(const sf::Vector2f& position, size_t k, float maxDistance, uint32_t layerMask,
+                                std::vector<BroadphaseNeighbour>& result, const ProxyFilter& filter = nullptr)
+        {
+            stats.queryCount++;
+            nearestBins(position, k, maxDistance, layerMask, result, filter);
+        }
+
+    protected:
+        void onBuild() override
+        {
+            for (uint32_t layer : usedLayers)
+            {
+                bins[layer].proxies.clear();
+                bins[layer].globalIndex.clear();
+            }
+            usedLayers.clear();
+
+            const auto& list = *proxies;
+            for (uint32_t i = 0; i < list.size(); ++i)
+            {
+                uint32_t layer = std::min(list[i].layer, CollisionMatrix::MaxLayers - 1);
+                Bin& bin = bins[layer];
+                if (bin.proxies.empty())
+                    usedLayers.push_back(layer);
+
+                bin.proxies.push_back(list[i]);
+                bin.globalIndex.push_back(i);
+            }
+
+            std::sort(usedLayers.begin(), usedLayers.end());
+            for (uint32_t layer : usedLayers)
+            {
+                Bin& bin = bins[layer];
+                if (!bin.backend)
+                    bin.backend = BroadphaseFactory::create(type);
+                bin.backend->build(bin.proxies);
+            }
+        }
+
+        void onFindPairs(std::vector<BroadphasePair>& pairs) override
+        {
+            for (size_t i = 0; i < usedLayers.size(); ++i)
+            {
+                uint32_t layerA = usedLayers[i];
+                Bin& binA = bins[layerA];
+
+                // Same-layer pairs
+                if (matrix->canCollide(layerA, layerA))
+                {
+                    localPairs.clear();
+                    binA.backend->findPairs(localPairs);
+                    for (const auto& pair : localPairs)
+                        emit(binA.globalIndex[pair.a], binA.globalIndex[pair.b], pairs);
+                }
+
+                // Cross-layer pairs: small bin queries big bin
+                for (size_t j = i + 1; j < usedLayers.size(); ++j)
+                {
+                    uint32_t layerB = usedLayers[j];
+                    if (!matrix->canCollide(layerA, layerB))
+                        continue;
+
+                    Bin& binB = bins[layerB];
+                    const Bin& small = (binA.proxies.size() <= binB.proxies.size()) ? binA : binB;
+                    const Bin& large = (&small == &binA) ? binB : binA;
+
+                    stats.queryCount += small.proxies.size();
+                    findCrossPairs(small, large, pairs);
+                }
+            }
+        }
+
+        void onQuery(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& result) const override
+        {
+            queryBins(minX, minY, maxX, maxY, 0xFFFFFFFF, result);
+        }
+
+        void onQueryNearest(const sf::Vector2f& position, size_t k, float maxDistance,
+                            std::vector<BroadphaseNeighbour>& result, const ProxyFilter& filter) const override
+        {
+            nearestBins(position, k, maxDistance, 0xFFFFFFFF, result, filter);
+        }
+
+        void onQuerySegment(const sf::Vector2f& start, const sf::Vector2f& end, float radius,
+                            std::vector<uint32_t>& result) const override
+        {
+            sweepBins(start, end, radius, 0xFFFFFFFF, result);
+        }
+
+    private:
+        struct Bin
+        {
+            std::vector<BroadphaseProxy> proxies;
+            std::vector<uint32_t> globalIndex; // Bin-local index -> caller's proxy index
+            std::unique_ptr<Broadphase> backend;
+        };
+
+        static void emit(uint32_t a, uint32_t b, std::vector<BroadphasePair>& pairs)
+        {
+            if (a < b)
+                pairs.push_back({ a, b });
+            else
+                pairs.push_back({ b, a });
+        }
+
+        void queryBins(float minX, float minY, float maxX, float maxY, uint32_t layerMask, std::vector<uint32_t>& result) const
+        {
+            for (uint32_t layer : usedLayers)
+            {
+                if ((layerMask & (1u << layer)) == 0)
+                    continue;
+
+                // Query appends bin-local indices, remap them in place
+                const Bin& bin = bins[layer];
+                size_t first = result.size();
+                bin.backend->queryBoxConcurrent(minX, minY, maxX, maxY, result);
+                for (size_t k = first; k < result.size(); ++k)
+                    result[k] = bin.globalIndex[result[k]];
+            }
+        }
+
+        // k nearest of each bin, merged: the k nearest overall are among them
+        void nearestBins(const sf::Vector2f& position, size_t k, float maxDistance, uint32_t layerMask,
+                         std::vector<BroadphaseNeighbour>& result, const ProxyFilter& filter) const
+        {
+            thread_local std::vector<BroadphaseNeighbour> binResult;
+            NearestCollector collector(k, maxDistance * maxDistance, result);
+
+            for (uint32_t layer : usedLayers)
+            {
+                if ((layerMask & (1u << layer)) == 0)
+                    continue;
+
+                const Bin& bin = bins[layer];
+                bin.backend->queryNearestConcurrent(position, k, maxDistance, binResult, filter);
+                for (const auto& neighbour : binResult)
+                    collector.offer(bin.globalIndex[neighbour.index], neighbour.distanceSquared);
+            }
+        }
+
+        void sweepBins(const sf::Vector2f& start, const sf::Vector2f& end, float radius,
+                       uint32_t layerMask, std::vector<uint32_t>& result) const
+        {
+            for (uint32_t layer : usedLayers)
+            {
+                if ((layerMask & (1u << layer)) == 0)
+                    continue;
+
+                const Bin& bin = bins[layer];
+                size_t first = result.size();
+                bin.backend->querySegmentConcurrent(start, end, radius, result);
+                for (size_t k = first; k < result.size(); ++k)
+                    result[k] = bin.globalIndex[result[k]];
+            }
+        }
+
+        /*
+         * MULTITHREADING: Cross-layer pairs split by spatial region
+         * - The small bin's proxies are ordered by coarse region (row-major RegionSize cells)
+         * - Consecutive runs of that order (= neighbouring regions) go to worker threads
+         * - Each run queries the large bin (read-only, queryBoxConcurrent) and writes
+         *   its own pair buffer; buffers are concatenated in run order
+         * - Output is identical for any number of threads
+         */
+        void findCrossPairs(const Bin& small, const Bin& large, std::vector<BroadphasePair>& pairs)
+        {
+            static constexpr float RegionSize = 256.f;
+            static constexpr size_t QueriesPerTask = 32;
+
+            regionKeys.clear();
+            for (uint32_t s = 0; s < small.proxies.size(); ++s)
+            {
+                const BroadphaseProxy& proxy = small.proxies[s];
+                int64_t regionX = static_cast<int64_t>(std::floor(proxy.position.x / RegionSize));
+                int64_t regionY = static_cast<int64_t>(std::floor(proxy.position.y / RegionSize));
+                uint64_t key = (static_cast<uint64_t>(regionY + (1ll << 31)) << 32) |
+                               static_cast<uint64_t>(regionX + (1ll << 31));
+                regionKeys.push_back({ key, s });
+            }
+            std::sort(regionKeys.begin(), regionKeys.end());
+
+            auto& pool = ThreadPool::getInstance();
+            workerResults.resize(pool.getThreadCount());
+
+            pool.parallelCollect(regionKeys.size(), QueriesPerTask, regionPairs, pairs,
+                [&](size_t begin, size_t end, size_t worker, std::vector<BroadphasePair>& out) {
+                    auto& result = workerResults[worker];
+                    for (size_t k = begin; k < end; ++k)
+                    {
+                        uint32_t s = regionKeys[k].second;
+                        const BroadphaseProxy& proxy = small.proxies[s];
+                        result.clear();
+                        large.backend->queryBoxConcurrent(proxy.minX, proxy.minY, proxy.maxX, proxy.maxY, result);
+                        for (uint32_t l : result)
+                            emit(small.globalIndex[s], large.globalIndex[l], out);
+                    }
+                });
+        }
+
+        BroadphaseType type;
+        const CollisionMatrix* matrix;
+
+        // Fixed size: backends keep a pointer to their bin's proxy vector
+        std::array<Bin, CollisionMatrix::MaxLayers> bins;
+        std::vector<uint32_t> usedLayers;
+
+        // Scratch buffers
+        std::vector<BroadphasePair> localPairs;
+        std::vector<std::pair<uint64_t, uint32_t>> regionKeys;   // (region, small-bin index)
+        std::vector<std::vector<BroadphasePair>> regionPairs;    // One output buffer per task
+        std::vector<std::vector<uint32_t>> workerResults;        // One query buffer per thread
+    };
+}
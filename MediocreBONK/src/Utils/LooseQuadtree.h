@@ -0,0 +1,197 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "Broadphase.h"
+
+namespace MediocreBONK::Utils
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: LOOSE QUADTREE
+     *
+     * Regular quadtree problem:
+     * - An entity sitting on a node border doesn't fit in any child
+     * - It gets stuck high up in the tree and is tested against everything below
+     *
+     * Loose quadtree:
+     * - Every node's bounds are enlarged ("loosened") by half its size on each side
+     * - An entity is stored by its CENTER, at the deepest level where
+     *   the node is at least as big as the entity
+     * - Border entities now always fit in a small node
+     * - Insert is O(1): the level comes from the entity size, the node from its center
+     *
+     * Implementation:
+     * - Stored as a pyramid of grids (level d = 2^d x 2^d nodes), no pointers
+     * - Each node counts the entities in its subtree, so empty branches are skipped
+     * - Root is fitted to the bounds of all entities every frame
+     *
+     * Trade-offs:
+     * - Adapts to non-uniform distributions (dense horde + sparse gems)
+     * - Query walks a tree instead of a flat grid (more branching per lookup)
+     */
+    class LooseQuadtree : public Broadphase
+    {
+    public:
+        LooseQuadtree(int maxDepth = 6)
+            : maxDepth(maxDepth)
+        {
+            // Total nodes in a full quadtree: (4^(depth+1) - 1) / 3
+            size_t nodeCount = ((size_t(1) << (2 * (maxDepth + 1))) - 1) / 3;
+            nodes.resize(nodeCount);
+        }
+
+        const char* getName() const override { return "Loose Quadtree"; }
+
+    protected:
+        void onBuild() override
+        {
+            const auto& list = *proxies;
+
+            // Reset only the nodes used last frame
+            for (size_t node : touchedNodes)
+            {
+                nodes[node].objects.clear();
+                nodes[node].subtreeCount = 0;
+            }
+            touchedNodes.clear();
+
+            if (list.empty())
+                return;
+
+            // Fit root to all entities (square, so every level has square nodes)
+            float minX = list[0].minX, minY = list[0].minY;
+            float maxX = list[0].maxX, maxY = list[0].maxY;
+            for (const auto& proxy : list)
+            {
+                minX = std::min(minX, proxy.minX);
+                minY = std::min(minY, proxy.minY);
+                maxX = std::max(maxX, proxy.maxX);
+                maxY = std::max(maxY, proxy.maxY);
+            }
+            originX = minX;
+            originY = minY;
+            rootSize = std::max(std::max(maxX - minX, maxY - minY), 1.f);
+
+            for (uint32_t i = 0; i < list.size(); ++i)
+            {
+                const BroadphaseProxy& proxy = list[i];
+                float extent = std::max(proxy.maxX - proxy.minX, proxy.maxY - proxy.minY);
+
+                // Deepest level whose node size still fits the entity
+                int level = 0;
+                float nodeSize = rootSize;
+                while (level < maxDepth && nodeSize * 0.5f >= extent)
+                {
+                    nodeSize *= 0.5f;
+                    ++level;
+                }
+
+                // Node containing the entity's center
+                int cells = 1 << level;
+                float centerX = (proxy.minX + proxy.maxX) * 0.5f;
+                float centerY = (proxy.minY + proxy.maxY) * 0.5f;
+                int x = std::clamp(static_cast<int>((centerX - originX) / nodeSize), 0, cells - 1);
+                int y = std::clamp(static_cast<int>((centerY - originY) / nodeSize), 0, cells - 1);
+
+                nodes[nodeIndex(level, x, y)].objects.push_back(i);
+
+                // Update subtree counts up to the root
+                for (; level >= 0; --level, x >>= 1, y >>= 1)
+                {
+                    size_t node = nodeIndex(level, x, y);
+                    if (nodes[node].subtreeCount++ == 0)
+                    {
+                        touchedNodes.push_back(node);
+                    }
+                }
+            }
+        }
+
+        void onFindPairs(std::vector<BroadphasePair>& pairs) override
+        {
+            const auto& list = *proxies;
+
+            for (uint32_t i = 0; i < list.size(); ++i)
+            {
+                const BroadphaseProxy& proxy = list[i];
+                scratch.clear();
+                collect(0, 0, 0, proxy.minX, proxy.minY, proxy.maxX, proxy.maxY, scratch);
+
+                // Only report each pair once (from its lower index)
+                for (uint32_t other : scratch)
+                {
+                    if (other > i)
+                    {
+                        pairs.push_back({ i, other });
+                    }
+                }
+            }
+        }
+
+        void onQuery(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& result) const override
+        {
+            if (proxies->empty())
+                return;
+
+            collect(0, 0, 0, minX, minY, maxX, maxY, result);
+        }
+
+    private:
+        struct Node
+        {
+            std::vector<uint32_t> objects; // Proxies stored at this node
+            uint32_t subtreeCount = 0;     // Proxies in this node + all descendants
+        };
+
+        // Recursive descent, skipping empty subtrees and nodes whose loose bounds miss the box
+        void collect(int level, int x, int y, float minX, float minY, float maxX, float maxY,
+                     std::vector<uint32_t>& result) const
+        {
+            const Node& node = nodes[nodeIndex(level, x, y)];
+            if (node.subtreeCount == 0)
+                return;
+
+            // Loose bounds: tight cell enlarged by half a cell on each side
+            float nodeSize = rootSize / static_cast<float>(1 << level);
+            float looseMinX = originX + (x - 0.5f) * nodeSize;
+            float looseMinY = originY + (y - 0.5f) * nodeSize;
+            float looseMaxX = looseMinX + nodeSize * 2.f;
+            float looseMaxY = looseMinY + nodeSize * 2.f;
+
+            if (looseMinX > maxX || looseMaxX < minX || looseMinY > maxY || looseMaxY < minY)
+                return;
+
+            for (uint32_t index : node.objects)
+            {
+                if ((*proxies)[index].overlaps(minX, minY, maxX, maxY))
+                {
+                    result.push_back(index);
+                }
+            }
+
+            if (level == maxDepth)
+                return;
+
+            for (int child = 0; child < 4; ++child)
+            {
+                collect(level + 1, x * 2 + (child & 1), y * 2 + (child >> 1), minX, minY, maxX, maxY, result);
+            }
+        }
+
+        // Pyramid layout: level d starts after all nodes of levels 0..d-1
+        size_t nodeIndex(int level, int x, int y) const
+        {
+            size_t levelStart = ((size_t(1) << (2 * level)) - 1) / 3;
+            return levelStart + static_cast<size_t>(y) * (size_t(1) << level) + x;
+        }
+
+        int maxDepth;
+        float originX = 0.f;
+        float originY = 0.f;
+        float rootSize = 1.f;
+
+        std::vector<Node> nodes;
+        std::vector<size_t> touchedNodes;  // Nodes to reset on next build
+        std::vector<uint32_t> scratch;     // Reused query buffer for pair finding
+    };
+}
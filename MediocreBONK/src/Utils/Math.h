@@ -1,6 +1,8 @@
 #pragma once
 #include <SFML/System/Vector2.hpp>
 #include <cmath>
+#include <algorithm>
+#include <utility>
 
 namespace MediocreBONK::Utils
 {
@@ -61,6 +63,54 @@ namespace MediocreBONK::Utils
             return a.x * b.x + a.y * b.y;
         }
 
+        // Rotate 'vec' by the angle of the unit vector 'rotation' (complex multiply, no trig)
+        static sf::Vector2f rotate(const sf::Vector2f& vec, const sf::Vector2f& rotation)
+        {
+            return sf::Vector2f(vec.x * rotation.x - vec.y * rotation.y,
+                                vec.x * rotation.y + vec.y * rotation.x);
+        }
+
+        // Swept circle vs static circle (continuous collision)
+        // Circle of 'radius' moves from start to start + delta, target circle at
+        // 'center' with 'targetRadius'. Returns true on contact, 'time' in [0, 1]
+        // is the first touching point along the move (0 = already overlapping).
+        // Solves |start + delta*t - center| = radius + targetRadius for t
+        static bool sweepCircle(const sf::Vector2f& start, const sf::Vector2f& delta, float radius,
+                                const sf::Vector2f& center, float targetRadius, float& time)
+        {
+            sf::Vector2f offset = start - center;
+            float radiusSum = radius + targetRadius;
+            float c = dot(offset, offset) - radiusSum * radiusSum;
+            if (c < 0.f)
+            {
+                time = 0.f; // Same rule as Collider::intersects (strict '<')
+                return true;
+            }
+
+            float a = dot(delta, delta);
+            float b = dot(offset, delta);
+            if (a == 0.f || b >= 0.f)
+                return false; // Not moving, or moving away
+
+            float discriminant = b * b - a * c;
+            if (discriminant < 0.f)
+                return false; // Passes beside the target
+
+            time = (-b - std::sqrt(discriminant)) / a;
+            return time <= 1.f;
+        }
+
+        // Segment start -> start + delta against an axis-aligned box (slab test)
+        // On overlap returns true and narrows [tMin, tMax] to the part inside the box
+        // (pass tMin = 0, tMax = 1 for the whole segment)
+        static bool clipSegmentToBox(const sf::Vector2f& start, const sf::Vector2f& delta,
+                                     float minX, float minY, float maxX, float maxY,
+                                     float& tMin, float& tMax)
+        {
+            return clipSlab(start.x, delta.x, minX, maxX, tMin, tMax) &&
+                   clipSlab(start.y, delta.y, minY, maxY, tMin, tMax);
+        }
+
         // Convert degrees to radians
         static float toRadians(float degrees)
         {
@@ -72,5 +122,21 @@ namespace MediocreBONK::Utils
         {
             return radians * 180.0f / 3.14159265f;
         }
+
+    private:
+        static bool clipSlab(float origin, float delta, float slabMin, float slabMax, float& tMin, float& tMax)
+        {
+            if (delta == 0.f)
+                return origin >= slabMin && origin <= slabMax;
+
+            float t0 = (slabMin - origin) / delta;
+            float t1 = (slabMax - origin) / delta;
+            if (t0 > t1)
+                std::swap(t0, t1);
+
+            tMin = std::max(tMin, t0);
+            tMax = std::min(tMax, t1);
+            return tMin <= tMax;
+        }
     };
 }
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <SFML/System/Vector2.hpp>
+
+namespace MediocreBONK::Utils
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: Z-ORDER (MORTON) CODES
+     *
+     * Problem:
+     * - Sorting 2D positions by x (or by row) keeps only ONE axis coherent:
+     *   vertical neighbours end up a whole row apart
+     *
+     * Solution: Interleave the bits of the cell coordinates
+     *   x = x2 x1 x0, y = y2 y1 y0  ->  code = y2 x2 y1 x1 y0 x0
+     * - Sorting by code walks the plane along a Z-shaped curve:
+     *   points close in 2D are (mostly) close in the sorted order
+     * - Used to order entity storage so spatial passes
+     *   (collision, separation, rendering) touch memory in order
+     *
+     * Usage:
+     *   uint64_t key = Morton::encode(position, origin, cellSize);
+     */
+    class Morton
+    {
+    public:
+        // Spread the 32 bits of v to the even bits of a 64-bit value
+        static uint64_t spreadBits(uint32_t v)
+        {
+            uint64_t x = v;
+            x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+            x = (x | (x << 8))  & 0x00FF00FF00FF00FFull;
+            x = (x | (x << 4))  & 0x0F0F0F0F0F0F0F0Full;
+            x = (x | (x << 2))  & 0x3333333333333333ull;
+            x = (x | (x << 1))  & 0x5555555555555555ull;
+            return x;
+        }
+
+        // Interleave two cell coordinates (x on even bits, y on odd bits)
+        static uint64_t encode(uint32_t x, uint32_t y)
+        {
+            return spreadBits(x) | (spreadBits(y) << 1);
+        }
+
+        // World position -> code of its cell, relative to 'origin' (e.g. min corner of all points)
+        static uint64_t encode(const sf::Vector2f& position, const sf::Vector2f& origin, float cellSize)
+        {
+            return encode(toCell(position.x - origin.x, cellSize), toCell(position.y - origin.y, cellSize));
+        }
+
+    private:
+        static uint32_t toCell(float offset, float cellSize)
+        {
+            float cell = std::floor(offset / cellSize);
+            if (!(cell > 0.f))
+                return 0; // Also catches NaN
+            return static_cast<uint32_t>(std::min(cell, 4294967295.f));
+        }
+    };
+}
@@ -0,0 +1,267 @@
+#pragma once
+#include "ThreadPool.h"
+#include "Profiler.h"
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <new>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+
+namespace MediocreBONK::Utils
+{
+    /*
+     * DESIGN PATTERN: TYPED OBJECT POOL (fixed-size slots, RAII handles)
+     *
+     * Problem:
+     * - Short-lived objects (Enemy/PowerUp wrappers, event payloads) were
+     *   allocated with make_unique every time: one heap round trip each,
+     *   scattered in memory, for objects that always have the same size
+     *
+     * Solution: Slots carved from large blocks, recycled through a free list
+     * - Storage grows one BLOCK (blockSize slots) at a time and is never
+     *   returned while the pool lives: steady state = zero heap allocations
+     * - acquire(args...) constructs T in a free slot (placement new)
+     * - Handle = unique_ptr with a pool deleter: destroying the handle runs
+     *   ~T and puts the slot back on the free list (RAII, no manual release)
+     * - Objects are constructed/destroyed normally: T needs no reset() method
+     *
+     * Thread-local caches (optional, setThreadCaches(true)):
+     * - The shared free list is guarded by a mutex
+     * - With caches on, every ThreadPool worker (see getWorkerIndex) keeps its
+     *   own small free list and only takes the lock to refill/spill half of it
+     * - Off by default: every current user acquires on the main thread
+     *
+     * Statistics: getStats() / recordStats() (Profiler counters)
+     *
+     * Usage:
+     *   Utils::ObjectPool<Foo> pool;
+     *   auto foo = pool.acquire(1, 2.f);   // Handle (unique_ptr<Foo, Deleter>)
+     *   foo.reset();                        // Slot back in the pool
+     *
+     * The pool must outlive every handle it gave out.
+     */
+    template<typename T>
+    class ObjectPool
+    {
+    public:
+        struct Deleter
+        {
+            ObjectPool* pool = nullptr;
+
+            void operator()(T* object) const
+            {
+                if (pool)
+                    pool->release(object);
+            }
+        };
+
+        using Handle = std::unique_ptr<T, Deleter>;
+
+        struct Stats
+        {
+            size_t capacity = 0;   // Slots allocated (blocks * blockSize)
+            size_t live = 0;       // Objects currently handed out
+            size_t peakLive = 0;
+            size_t acquired = 0;   // Total acquire() calls
+            size_t blocks = 0;     // Heap allocations made by the pool
+        };
+
+        explicit ObjectPool(size_t blockSize = 64, size_t initialCapacity = 0)
+            : blockSize(std::max<size_t>(blockSize, 1))
+            , threadCaches(false)
+            , live(0)
+            , peakLive(0)
+            , acquiredCount(0)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            while (capacityLocked() < initialCapacity)
+                growLocked();
+        }
+
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        // Construct a T in a recycled slot
+        template<typename... Args>
+        Handle acquire(Args&&... args)
+        {
+            return Handle(create(std::forward<Args>(args)...), Deleter{ this });
+        }
+
+        // Raw version for owners that manage the lifetime themselves (pair with release())
+        template<typename... Args>
+        T* create(Args&&... args)
+        {
+            void* slot = takeSlot();
+            T* object = nullptr;
+            try
+            {
+                object = new (slot) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                giveSlot(slot);
+                throw;
+            }
+
+            size_t now = live.fetch_add(1, std::memory_order_relaxed) + 1;
+            size_t peak = peakLive.load(std::memory_order_relaxed);
+            while (now > peak && !peakLive.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+            acquiredCount.fetch_add(1, std::memory_order_relaxed);
+            return object;
+        }
+
+        // Destroy the object and recycle its slot
+        void release(T* object)
+        {
+            if (!object)
+                return;
+
+            object->~T();
+            live.fetch_sub(1, std::memory_order_relaxed);
+            giveSlot(object);
+        }
+
+        // Per-worker free lists (only matters when several threads acquire/release)
+        void setThreadCaches(bool enabled)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!enabled)
+                flushCachesLocked();
+            threadCaches = enabled;
+        }
+
+        Stats getStats() const
+        {
+            Stats stats;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stats.capacity = capacityLocked();
+                stats.blocks = blocks.size();
+            }
+            stats.live = live.load(std::memory_order_relaxed);
+            stats.peakLive = peakLive.load(std::memory_order_relaxed);
+            stats.acquired = acquiredCount.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+        // Profiler counters "<name> Live" / "<name> Capacity"
+        void recordStats(const std::string& name) const
+        {
+            Stats stats = getStats();
+            Profiler::record(name + " Live", static_cast<long long>(stats.live));
+            Profiler::record(name + " Capacity", static_cast<long long>(stats.capacity));
+        }
+
+    private:
+        // One slot: raw storage big and aligned enough for a T
+        struct alignas(T) Slot
+        {
+            unsigned char bytes[sizeof(T)];
+        };
+
+        static constexpr size_t MaxThreadCache = 32;
+
+        void* takeSlot()
+        {
+            if (threadCaches)
+            {
+                auto& cache = cacheFor(ThreadPool::getWorkerIndex());
+                if (cache.empty())
+                {
+                    // Refill half a cache in one lock
+                    std::lock_guard<std::mutex> lock(mutex);
+                    while (cache.size() < MaxThreadCache / 2)
+                    {
+                        if (freeSlots.empty())
+                            growLocked();
+                        cache.push_back(freeSlots.back());
+                        freeSlots.pop_back();
+                    }
+                }
+                void* slot = cache.back();
+                cache.pop_back();
+                return slot;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (freeSlots.empty())
+                growLocked();
+            void* slot = freeSlots.back();
+            freeSlots.pop_back();
+            return slot;
+        }
+
+        void giveSlot(void* slot)
+        {
+            if (threadCaches)
+            {
+                auto& cache = cacheFor(ThreadPool::getWorkerIndex());
+                cache.push_back(slot);
+                if (cache.size() >= MaxThreadCache)
+                {
+                    // Spill half back to the shared list
+                    std::lock_guard<std::mutex> lock(mutex);
+                    size_t keep = MaxThreadCache / 2;
+                    freeSlots.insert(freeSlots.end(), cache.begin() + keep, cache.end());
+                    cache.resize(keep);
+                }
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            freeSlots.push_back(slot);
+        }
+
+        // Caches are created up front for every thread the ThreadPool can run
+        std::vector<void*>& cacheFor(size_t worker)
+        {
+            std::call_once(cachesCreated, [this] {
+                caches.resize(ThreadPool::getInstance().getThreadCount());
+                for (auto& cache : caches)
+                    cache.reserve(MaxThreadCache);
+            });
+            return caches[std::min(worker, caches.size() - 1)];
+        }
+
+        void flushCachesLocked()
+        {
+            for (auto& cache : caches)
+            {
+                freeSlots.insert(freeSlots.end(), cache.begin(), cache.end());
+                cache.clear();
+            }
+        }
+
+        void growLocked()
+        {
+            blocks.push_back(std::make_unique<Slot[]>(blockSize));
+            Slot* block = blocks.back().get();
+            freeSlots.reserve(capacityLocked());
+
+            // Reverse order: slots are handed out front to back
+            for (size_t i = blockSize; i-- > 0;)
+                freeSlots.push_back(&block[i]);
+        }
+
+        size_t capacityLocked() const { return blocks.size() * blockSize; }
+
+        size_t blockSize;
+        bool threadCaches;
+
+        mutable std::mutex mutex;
+        std::vector<std::unique_ptr<Slot[]>> blocks; // Never shrinks (addresses stay valid)
+        std::vector<void*> freeSlots;                // Shared free list (guarded by mutex)
+
+        std::once_flag cachesCreated;
+        std::vector<std::vector<void*>> caches;     // Index = ThreadPool worker index
+
+        std::atomic<size_t> live;
+        std::atomic<size_t> peakLive;
+        std::atomic<size_t> acquiredCount;
+    };
+}
@@ -38,10 +38,19 @@ namespace MediocreBONK::Utils
             }
         }
 
+        // Record a per-frame value (e.g. pair count), averaged in logResults()
+        static void record(const std::string& name, long long value)
+        {
+            values[name] += value;
+            valueCounts[name]++;
+        }
+
         static void reset()
         {
             results.clear();
             counts.clear();
+            values.clear();
+            valueCounts.clear();
         }
 
         static void logResults()
@@ -56,6 +65,14 @@ namespace MediocreBONK::Utils
                     Logger::info(result.first + ": " + std::to_string(avg) + "us");
                 }
             }
+            for (const auto& value : values)
+            {
+                long long count = valueCounts[value.first];
+                if (count > 0)
+                {
+                    Logger::info(value.first + ": " + std::to_string(value.second / count));
+                }
+            }
             Logger::info("=========================================");
             reset();
         }
@@ -64,10 +81,14 @@ namespace MediocreBONK::Utils
         static std::unordered_map<std::string, std::chrono::time_point<std::chrono::high_resolution_clock>> startTimePoints;
         static std::unordered_map<std::string, long long> results;
         static std::unordered_map<std::string, long long> counts;
+        static std::unordered_map<std::string, long long> values;
+        static std::unordered_map<std::string, long long> valueCounts;
     };
 
     // Define static members
     inline std::unordered_map<std::string, std::chrono::time_point<std::chrono::high_resolution_clock>> Profiler::startTimePoints;
     inline std::unordered_map<std::string, long long> Profiler::results;
     inline std::unordered_map<std::string, long long> Profiler::counts;
+    inline std::unordered_map<std::string, long long> Profiler::values;
+    inline std::unordered_map<std::string, long long> Profiler::valueCounts;
 }
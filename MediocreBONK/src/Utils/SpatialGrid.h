@@ -3,9 +3,8 @@
 #include <unordered_map>
 #include <cmath>
 #include <algorithm>
-#include "../ECS/Entity.h"
-#include "../ECS/Components/Transform.h"
-#include "../ECS/Components/Collider.h"
+#include <limits>
+#include "Broadphase.h"
 
 namespace MediocreBONK::Utils
 {
@@ -43,94 +42,315 @@ namespace MediocreBONK::Utils
      * - Should be ~2x the size of typical entity
      * - For this game: 100 pixels (entities are 10-40 pixels)
      *
-     * Alternative approaches:
-     * - Quadtree: Better for non-uniform entity distribution
-     * - Spatial hash: Similar but uses hash function instead of grid
+     * Pair finding without duplicates:
+     * - An overlapping pair can share several cells
+     * - Each pair is reported only by its "owner" cell: the cell containing
+     *   the top-left corner of the two boxes' intersection
+     * - No sort/unique pass over the results needed
+     *
+     * Alternative approaches (see Broadphase.h):
+     * - Quadtree: Better for non-uniform entity distribution (LooseQuadtree)
+     * - Sweep and prune: Better when entities barely move between frames (SweepAndPrune)
      * - Bounding volume hierarchy: Better for static geometry
      */
-    class SpatialGrid
+    class SpatialGrid : public Broadphase
     {
     public:
         SpatialGrid(float cellSize = 100.f)
             : cellSize(cellSize)
         {}
 
-        // Clear grid (called at start of each frame)
-        void clear()
-        {
-            grid.clear();
-        }
+        const char* getName() const override { return "Uniform Grid"; }
 
-        // Insert entity into all grid cells it overlaps
+    protected:
+        // Insert every proxy into all grid cells it overlaps
         // Large entities may span multiple cells
-        void insert(ECS::Entity* entity)
+        void onBuild() override
         {
-            auto* transform = entity->getComponent<ECS::Components::Transform>();
-            auto* collider = entity->getComponent<ECS::Components::Collider>();
+            clear();
 
-            if (!transform || !collider) return;
+            for (uint32_t i = 0; i < proxies->size(); ++i)
+            {
+                const BroadphaseProxy& proxy = (*proxies)[i];
 
-            // Calculate which grid cells this entity overlaps
-            // Entity's bounding box: (position - radius) to (position + radius)
-            int minX = static_cast<int>((transform->position.x - collider->radius) / cellSize);
-            int maxX = static_cast<int>((transform->position.x + collider->radius) / cellSize);
-            int minY = static_cast<int>((transform->position.y - collider->radius) / cellSize);
-            int maxY = static_cast<int>((transform->position.y + collider->radius) / cellSize);
+                // Calculate which grid cells this entity overlaps
+                // Entity's bounding box: (position - radius) to (position + radius)
+                int minX = toCell(proxy.minX);
+                int maxX = toCell(proxy.maxX);
+                int minY = toCell(proxy.minY);
+                int maxY = toCell(proxy.maxY);
+
+                // Insert entity into all overlapping cells
+                for (int x = minX; x <= maxX; ++x)
+                {
+                    for (int y = minY; y <= maxY; ++y)
+                    {
+                        auto& cell = grid[getKey(x, y)];
+                        if (cell.empty())
+                        {
+                            occupiedCells.push_back(getKey(x, y));
+                        }
+                        cell.push_back(i);
+                    }
+                }
+            }
+        }
 
-            // Insert entity into all overlapping cells
-            for (int x = minX; x <= maxX; ++x)
+        // Test all proxies sharing a cell, report each pair only in its owner cell
+        void onFindPairs(std::vector<BroadphasePair>& pairs) override
+        {
+            for (long long key : occupiedCells)
             {
-                for (int y = minY; y <= maxY; ++y)
+                const auto& cell = grid[key];
+
+                for (size_t i = 0; i < cell.size(); ++i)
                 {
-                    grid[getKey(x, y)].push_back(entity);
+                    const BroadphaseProxy& a = (*proxies)[cell[i]];
+
+                    for (size_t j = i + 1; j < cell.size(); ++j)
+                    {
+                        const BroadphaseProxy& b = (*proxies)[cell[j]];
+
+                        if (!a.overlaps(b))
+                            continue;
+
+                        // Owner cell check: skip if another cell reports this pair
+                        int ownerX = toCell(std::max(a.minX, b.minX));
+                        int ownerY = toCell(std::max(a.minY, b.minY));
+                        if (getKey(ownerX, ownerY) != key)
+                            continue;
+
+                        pairs.push_back({ std::min(cell[i], cell[j]), std::max(cell[i], cell[j]) });
+                    }
                 }
             }
         }
 
-        // SPATIAL QUERY: Find all entities near a position
-        // Returns: List of entities in nearby grid cells
-        // Note: May contain duplicates if entity spans multiple cells
-        std::vector<ECS::Entity*> query(const sf::Vector2f& position, float radius)
+        // SPATIAL QUERY: Find all proxies near a box
+        // Returns: proxies from overlapping cells whose AABB overlaps the box
+        void onQuery(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& result) const override
         {
-            std::vector<ECS::Entity*> result;
+            size_t first = result.size();
 
             // Calculate which cells to search
-            // Search area: circle of given radius around position
-            int minX = static_cast<int>((position.x - radius) / cellSize);
-            int maxX = static_cast<int>((position.x + radius) / cellSize);
-            int minY = static_cast<int>((position.y - radius) / cellSize);
-            int maxY = static_cast<int>((position.y + radius) / cellSize);
-
-            // OPTIMIZATION: Could return duplicates for speed (let caller handle)
-            // QUALITY: Removing duplicates here for correctness
+            int cellMinX = toCell(minX);
+            int cellMaxX = toCell(maxX);
+            int cellMinY = toCell(minY);
+            int cellMaxY = toCell(maxY);
 
             // Collect entities from all nearby cells
-            for (int x = minX; x <= maxX; ++x)
+            for (int x = cellMinX; x <= cellMaxX; ++x)
             {
-                for (int y = minY; y <= maxY; ++y)
+                for (int y = cellMinY; y <= cellMaxY; ++y)
                 {
                     auto it = grid.find(getKey(x, y));
-                    if (it != grid.end())
+                    if (it == grid.end())
+                        continue;
+
+                    for (uint32_t index : it->second)
                     {
-                        // Add all entities in this cell
-                        result.insert(result.end(), it->second.begin(), it->second.end());
+                        if ((*proxies)[index].overlaps(minX, minY, maxX, maxY))
+                        {
+                            result.push_back(index);
+                        }
                     }
                 }
             }
 
             // Remove duplicates (entity may be in multiple cells)
             // Sort + unique is faster than set for small lists
-            std::sort(result.begin(), result.end());
-            result.erase(std::unique(result.begin(), result.end()), result.end());
+            std::sort(result.begin() + first, result.end());
+            result.erase(std::unique(result.begin() + first, result.end()), result.end());
+        }
+
+        /*
+         * CONTINUOUS COLLISION: DDA traversal (Amanatides & Woo)
+         * - A fast bullet's swept AABB covers many empty cells (diagonal shots!)
+         * - Instead walk only the cells the segment passes through, in order:
+         *   tMaxX/tMaxY = segment time of the next vertical/horizontal cell border,
+         *   step along whichever comes first
+         * - The circle has a radius: for each step, look at the cells under the
+         *   piece of segment inside the current cell, grown by the radius
+         *   (usually 1 cell, up to 4 near corners)
+         * - Cost grows with segment LENGTH / cellSize, not with its bounding box
+         */
+        void onQuerySegment(const sf::Vector2f& start, const sf::Vector2f& end, float radius,
+                            std::vector<uint32_t>& result) const override
+        {
+            size_t first = result.size();
+            sf::Vector2f delta = end - start;
+
+            int cellX = toCell(start.x);
+            int cellY = toCell(start.y);
+            int stepX = delta.x > 0.f ? 1 : (delta.x < 0.f ? -1 : 0);
+            int stepY = delta.y > 0.f ? 1 : (delta.y < 0.f ? -1 : 0);
+
+            // Segment time of the first border crossing and of one full cell on each axis
+            const float never = std::numeric_limits<float>::infinity();
+            float tMaxX = stepX != 0 ? ((cellX + (stepX > 0 ? 1 : 0)) * cellSize - start.x) / delta.x : never;
+            float tMaxY = stepY != 0 ? ((cellY + (stepY > 0 ? 1 : 0)) * cellSize - start.y) / delta.y : never;
+            float tDeltaX = stepX != 0 ? cellSize / std::abs(delta.x) : never;
+            float tDeltaY = stepY != 0 ? cellSize / std::abs(delta.y) : never;
+
+            // Border crossings on the way (bounds the loop even with float drift)
+            int steps = std::abs(toCell(end.x) - cellX) + std::abs(toCell(end.y) - cellY);
+
+            float tEnter = 0.f;
+            for (int step = 0; ; ++step)
+            {
+                float tExit = (step == steps) ? 1.f : std::min(std::min(tMaxX, tMaxY), 1.f);
+                sf::Vector2f from = start + delta * tEnter;
+                sf::Vector2f to = start + delta * tExit;
+                gatherSegmentCells(std::min(from.x, to.x) - radius, std::min(from.y, to.y) - radius,
+                                   std::max(from.x, to.x) + radius, std::max(from.y, to.y) + radius,
+                                   start, end, radius, result);
+
+                if (step == steps || tExit >= 1.f)
+                    break;
+
+                if (tMaxX < tMaxY)
+                {
+                    tEnter = tMaxX;
+                    tMaxX += tDeltaX;
+                }
+                else
+                {
+                    tEnter = tMaxY;
+                    tMaxY += tDeltaY;
+                }
+            }
+
+            // Neighbouring steps share cells, big proxies span several
+            std::sort(result.begin() + first, result.end());
+            result.erase(std::unique(result.begin() + first, result.end()), result.end());
+        }
+
+        /*
+         * NEAREST NEIGHBOURS: Expanding ring search
+         * - Ring 0 = the query point's cell, ring r = cells at Chebyshev distance r
+         * - A proxy is only considered in the cell holding its CENTER
+         *   (it may span more cells: this avoids duplicates without a visited set)
+         * - Every cell of ring r+1 is at least r * cellSize away from the point:
+         *   once k neighbours are closer than that, the search stops
+         * - Near the player this is 1-2 rings (9-25 cell lookups) whatever the
+         *   total enemy count
+         */
+        void onQueryNearest(const sf::Vector2f& position, size_t k, float maxDistance,
+                            std::vector<BroadphaseNeighbour>& result, const ProxyFilter& filter) const override
+        {
+            NearestCollector collector(k, maxDistance * maxDistance, result);
+            if (k == 0 || occupiedCells.empty())
+                return;
+
+            int centerX = toCell(position.x);
+            int centerY = toCell(position.y);
 
-            return result;
+            // Rings needed to cover every occupied cell (and no more than maxDistance)
+            int lastRing = std::max(std::max(std::abs(toCell(bounds.minX) - centerX), std::abs(toCell(bounds.maxX) - centerX)),
+                                    std::max(std::abs(toCell(bounds.minY) - centerY), std::abs(toCell(bounds.maxY) - centerY)));
+            if (maxDistance / cellSize < static_cast<float>(lastRing))
+                lastRing = static_cast<int>(maxDistance / cellSize) + 1;
+
+            for (int ring = 0; ring <= lastRing; ++ring)
+            {
+                for (int y = centerY - ring; y <= centerY + ring; ++y)
+                {
+                    // Inner rows: only the left and right cell belong to the ring
+                    bool edgeRow = (y == centerY - ring || y == centerY + ring);
+                    int stepX = (edgeRow || ring == 0) ? 1 : 2 * ring;
+                    for (int x = centerX - ring; x <= centerX + ring; x += stepX)
+                        offerCell(x, y, position, filter, collector);
+                }
+
+                float reach = ring * cellSize;
+                if (collector.full() && collector.worstDistanceSquared() <= reach * reach)
+                    break;
+            }
         }
 
     private:
+        void offerCell(int x, int y, const sf::Vector2f& position, const ProxyFilter& filter,
+                       NearestCollector& collector) const
+        {
+            long long key = getKey(x, y);
+            auto it = grid.find(key);
+            if (it == grid.end())
+                return;
+
+            for (uint32_t index : it->second)
+            {
+                const BroadphaseProxy& proxy = (*proxies)[index];
+                if (getKey(toCell(proxy.position.x), toCell(proxy.position.y)) != key)
+                    continue; // Reported by the cell holding its center
+
+                float dx = proxy.position.x - position.x;
+                float dy = proxy.position.y - position.y;
+                float distanceSquared = dx * dx + dy * dy;
+                if (distanceSquared <= collector.worstDistanceSquared())
+                {
+                    if (!filter || filter(proxy))
+                        collector.offer(index, distanceSquared);
+                }
+            }
+        }
+
+        // Proxies in the cells under a box that the swept circle actually touches
+        void gatherSegmentCells(float minX, float minY, float maxX, float maxY,
+                                const sf::Vector2f& start, const sf::Vector2f& end, float radius,
+                                std::vector<uint32_t>& result) const
+        {
+            for (int x = toCell(minX); x <= toCell(maxX); ++x)
+            {
+                for (int y = toCell(minY); y <= toCell(maxY); ++y)
+                {
+                    auto it = grid.find(getKey(x, y));
+                    if (it == grid.end())
+                        continue;
+
+                    for (uint32_t index : it->second)
+                    {
+                        if ((*proxies)[index].overlapsSegment(start, end, radius))
+                            result.push_back(index);
+                    }
+                }
+            }
+        }
+
+        // Clear grid (called at start of each frame)
+        // OPTIMIZATION: Keep cell vectors (and their capacity) between frames,
+        // only drop empty cells once they clearly outnumber the occupied ones
+        void clear()
+        {
+            for (long long key : occupiedCells)
+            {
+                grid[key].clear();
+            }
+
+            if (grid.size() > occupiedCells.size() * 4 + 64)
+            {
+                for (auto it = grid.begin(); it != grid.end();)
+                {
+                    if (it->second.empty())
+                        it = grid.erase(it);
+                    else
+                        ++it;
+                }
+            }
+
+            occupiedCells.clear();
+        }
+
+        // World coordinate -> cell coordinate
+        // floor() keeps negative coordinates in the correct cell
+        int toCell(float coordinate) const
+        {
+            return static_cast<int>(std::floor(coordinate / cellSize));
+        }
+
         // Hash 2D coordinates to single key for unordered_map
         // Combines x and y into 64-bit integer
         // Upper 32 bits = x, lower 32 bits = y
-        long long getKey(int x, int y)
+        long long getKey(int x, int y) const
         {
             return (static_cast<long long>(x) << 32) | (static_cast<unsigned int>(y));
         }
@@ -138,8 +358,11 @@ namespace MediocreBONK::Utils
         // Grid parameters
         float cellSize; // Size of each grid cell in world units
 
-        // Grid storage: cell key -> list of entities in that cell
+        // Grid storage: cell key -> list of proxy indices in that cell
         // Rebuilt each frame (entities move, so grid changes)
-        std::unordered_map<long long, std::vector<ECS::Entity*>> grid;
+        std::unordered_map<long long, std::vector<uint32_t>> grid;
+
+        // Cells touched this frame (insertion order, keeps pair output deterministic)
+        std::vector<long long> occupiedCells;
     };
 }
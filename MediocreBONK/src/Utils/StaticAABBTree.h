@@ -0,0 +1,182 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <SFML/System/Vector2.hpp>
+#include "Math.h"
+
+namespace MediocreBONK::Utils
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: STATIC AABB TREE (Bounding Volume Hierarchy)
+     *
+     * Problem:
+     * - Rocks and walls never move, but the dynamic broadphase is rebuilt
+     *   every frame: static geometry in it is pure rebuild overhead
+     * - Static-vs-static pairs would also be found (and discarded) every frame
+     *
+     * Solution: A separate tree for static geometry, built ONCE
+     * - Built top-down when a world tile is generated, dropped with the tile
+     * - Each node bounds its children; leaves hold a few items
+     * - Split: sort item centers along the longest axis, cut at the median
+     *   -> balanced tree, depth ~ log2(n)
+     * - Nodes live in one flat array (children by index, no pointers)
+     * - Only dynamic colliders query it: static-vs-static is never tested
+     *
+     * Queries (read-only, safe from several threads):
+     *   tree.query(minX, minY, maxX, maxY, out);   // Items whose box overlaps
+     *   tree.querySegment(a, b, radius, out);      // Items a moving circle may touch
+     * Results are item indices (position in the box list given to build()).
+     */
+    class StaticAABBTree
+    {
+    public:
+        struct Box
+        {
+            float minX;
+            float minY;
+            float maxX;
+            float maxY;
+        };
+
+        // Build from item boxes (item index = position in 'boxes')
+        void build(const std::vector<Box>& boxes)
+        {
+            clear();
+            if (boxes.empty())
+                return;
+
+            itemBoxes = boxes;
+            items.resize(boxes.size());
+            for (uint32_t i = 0; i < items.size(); ++i)
+                items[i] = i;
+
+            nodes.reserve(boxes.size() * 2);
+            buildNode(0, static_cast<uint32_t>(items.size()));
+        }
+
+        void clear()
+        {
+            nodes.clear();
+            items.clear();
+            itemBoxes.clear();
+        }
+
+        bool empty() const { return nodes.empty(); }
+        size_t getNodeCount() const { return nodes.size(); }
+
+        // Append items whose box overlaps the query box
+        void query(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& result) const
+        {
+            traverse(result,
+                [&](const Box& box) { return overlaps(box, minX, minY, maxX, maxY); });
+        }
+
+        // Append items whose box (grown by radius) the segment start -> end touches
+        void querySegment(const sf::Vector2f& start, const sf::Vector2f& end, float radius,
+                          std::vector<uint32_t>& result) const
+        {
+            sf::Vector2f delta = end - start;
+            traverse(result, [&](const Box& box) {
+                float tMin = 0.f;
+                float tMax = 1.f;
+                return Math::clipSegmentToBox(start, delta, box.minX - radius, box.minY - radius,
+                                              box.maxX + radius, box.maxY + radius, tMin, tMax);
+            });
+        }
+
+    private:
+        static constexpr uint32_t LeafSize = 4;
+        static constexpr int MaxDepth = 32;
+
+        struct Node
+        {
+            Box bounds;
+            uint32_t left;   // Inner node: child indices
+            uint32_t right;
+            uint32_t first;  // Leaf: items[first .. first + count)
+            uint32_t count;  // 0 = inner node
+        };
+
+        static bool overlaps(const Box& box, float minX, float minY, float maxX, float maxY)
+        {
+            return box.minX <= maxX && box.maxX >= minX &&
+                   box.minY <= maxY && box.maxY >= minY;
+        }
+
+        // Depth-first walk, 'test' decides whether a node/item box is visited
+        template<typename Test>
+        void traverse(std::vector<uint32_t>& result, Test test) const
+        {
+            if (nodes.empty())
+                return;
+
+            uint32_t stack[MaxDepth * 2];
+            int top = 0;
+            stack[top++] = 0;
+
+            while (top > 0)
+            {
+                const Node& node = nodes[stack[--top]];
+                if (!test(node.bounds))
+                    continue;
+
+                if (node.count > 0)
+                {
+                    for (uint32_t i = node.first; i < node.first + node.count; ++i)
+                    {
+                        if (test(itemBoxes[items[i]]))
+                            result.push_back(items[i]);
+                    }
+                }
+                else
+                {
+                    stack[top++] = node.left;
+                    stack[top++] = node.right;
+                }
+            }
+        }
+
+        // Builds the node for items[first .. first + count), returns its index
+        uint32_t buildNode(uint32_t first, uint32_t count, int depth = 0)
+        {
+            uint32_t index = static_cast<uint32_t>(nodes.size());
+            nodes.push_back({});
+
+            Box bounds = itemBoxes[items[first]];
+            for (uint32_t i = first + 1; i < first + count; ++i)
+            {
+                const Box& box = itemBoxes[items[i]];
+                bounds.minX = std::min(bounds.minX, box.minX);
+                bounds.minY = std::min(bounds.minY, box.minY);
+                bounds.maxX = std::max(bounds.maxX, box.maxX);
+                bounds.maxY = std::max(bounds.maxY, box.maxY);
+            }
+
+            if (count <= LeafSize || depth >= MaxDepth - 1)
+            {
+                nodes[index] = { bounds, 0, 0, first, count };
+                return index;
+            }
+
+            // Median split along the longest axis of the node
+            bool splitX = (bounds.maxX - bounds.minX) >= (bounds.maxY - bounds.minY);
+            auto center = [&](uint32_t item) {
+                const Box& box = itemBoxes[item];
+                return splitX ? box.minX + box.maxX : box.minY + box.maxY;
+            };
+            uint32_t half = count / 2;
+            std::nth_element(items.begin() + first, items.begin() + first + half, items.begin() + first + count,
+                [&](uint32_t a, uint32_t b) { return center(a) < center(b); });
+
+            uint32_t left = buildNode(first, half, depth + 1);
+            uint32_t right = buildNode(first + half, count - half, depth + 1);
+            nodes[index] = { bounds, left, right, 0, 0 };
+            return index;
+        }
+
+        std::vector<Node> nodes;       // nodes[0] = root
+        std::vector<uint32_t> items;   // Item indices, grouped by leaf
+        std::vector<Box> itemBoxes;
+    };
+}
@@ -0,0 +1,218 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include <SFML/System/Vector2.hpp>
+
+namespace MediocreBONK::Utils
+{
+    // Result of one steering decision (AI applies it every tick until the next one)
+    enum class SteeringMode : uint8_t
+    {
+        None,   // Out of range / idle: no force
+        Move,   // Force along the direction
+        Hold    // Stand still (e.g. chaser in attack range)
+    };
+
+    /*
+     * OPTIMIZATION TECHNIQUE: BEHAVIOUR-BUCKETED STEERING KERNELS
+     *
+     * Problem:
+     * - AI::update switched on the behaviour per entity: with several real
+     *   behaviours in one horde the branch flips from one enemy to the next
+     *   (mispredictions) and each enemy chased its components through pointers
+     *
+     * Solution: One batch per behaviour, one straight loop per batch
+     * - Enemies that think this tick are gathered into the batch of their
+     *   behaviour, Structure of Arrays: position, target, ranges, parameter...
+     * - Each kernel is a loop without data-dependent branches (selects only):
+     *   compilers vectorise it (4-8 enemies per instruction)
+     * - Per-entity work that can't vectorise (flow field lookup) happens
+     *   while gathering; its result is just another input column
+     * - The per-element functions are shared with AI::think() (single enemy,
+     *   same results)
+     *
+     * Behaviours:
+     * - Chase:  flow field direction (or straight line), hold in attack range
+     * - Flee:   straight away from the target
+     * - Ranged: keep 'param' distance (approach / back off), strafe around
+     *           the target inside the band
+     * - Circle: orbit at 'param' radius (spiral in/out), 'spin' = +1 / -1
+     */
+
+    // Structure-of-Arrays steering inputs + outputs of one behaviour
+    struct SteeringBatch
+    {
+        // In
+        std::vector<float> posX;
+        std::vector<float> posY;
+        std::vector<float> targetX;
+        std::vector<float> targetY;
+        std::vector<float> detectionSq;  // Detection range squared
+        std::vector<float> attackSq;     // Attack range squared
+        std::vector<float> flowX;        // Chase: field direction, (0,0) = straight line
+        std::vector<float> flowY;
+        std::vector<float> param;        // Ranged: preferred distance, Circle: orbit radius
+        std::vector<float> spin;         // Ranged / Circle: +1 or -1
+        // Out
+        std::vector<float> dirX;
+        std::vector<float> dirY;
+        std::vector<SteeringMode> mode;
+
+        void add(const sf::Vector2f& position, const sf::Vector2f& target, float detectionRange,
+                 float attackRange, const sf::Vector2f& flow, float parameter, float spinDirection)
+        {
+            posX.push_back(position.x);
+            posY.push_back(position.y);
+            targetX.push_back(target.x);
+            targetY.push_back(target.y);
+            detectionSq.push_back(detectionRange * detectionRange);
+            attackSq.push_back(attackRange * attackRange);
+            flowX.push_back(flow.x);
+            flowY.push_back(flow.y);
+            param.push_back(parameter);
+            spin.push_back(spinDirection);
+        }
+
+        void clear()
+        {
+            posX.clear(); posY.clear();
+            targetX.clear(); targetY.clear();
+            detectionSq.clear(); attackSq.clear();
+            flowX.clear(); flowY.clear();
+            param.clear(); spin.clear();
+            dirX.clear(); dirY.clear();
+            mode.clear();
+        }
+
+        size_t size() const { return posX.size(); }
+        bool empty() const { return posX.empty(); }
+    };
+
+    class SteeringKernels
+    {
+    public:
+        // Per element (inline: the batch loops below vectorise through them)
+
+        static void chase(float px, float py, float tx, float ty, float detectionSq, float attackSq,
+                          float fx, float fy, float& dx, float& dy, SteeringMode& mode)
+        {
+            float ox = tx - px;
+            float oy = ty - py;
+            float distanceSq = ox * ox + oy * oy;
+            float inverse = distanceSq > 0.f ? 1.f / std::sqrt(distanceSq) : 0.f;
+            bool hasFlow = fx != 0.f || fy != 0.f;
+
+            dx = hasFlow ? fx : ox * inverse;
+            dy = hasFlow ? fy : oy * inverse;
+            mode = distanceSq > detectionSq ? SteeringMode::None
+                 : (distanceSq < attackSq ? SteeringMode::Hold : SteeringMode::Move);
+        }
+
+        static void flee(float px, float py, float tx, float ty, float detectionSq,
+                         float& dx, float& dy, SteeringMode& mode)
+        {
+            float ox = px - tx;
+            float oy = py - ty;
+            float distanceSq = ox * ox + oy * oy;
+            float inverse = distanceSq > 0.f ? 1.f / std::sqrt(distanceSq) : 0.f;
+
+            dx = ox * inverse;
+            dy = oy * inverse;
+            mode = distanceSq > detectionSq ? SteeringMode::None : SteeringMode::Move;
+        }
+
+        static void ranged(float px, float py, float tx, float ty, float detectionSq,
+                           float preferred, float spin, float& dx, float& dy, SteeringMode& mode)
+        {
+            float ox = tx - px;
+            float oy = ty - py;
+            float distanceSq = ox * ox + oy * oy;
+            float distance = std::sqrt(distanceSq);
+            float inverse = distance > 0.f ? 1.f / distance : 0.f;
+
+            // -1 (too close: back off) .. +1 (too far: approach), 0 = in the band
+            float band = std::max(preferred * 0.2f, 1.f);
+            float radial = std::clamp((distance - preferred) / band, -1.f, 1.f);
+            float strafe = (1.f - std::abs(radial)) * spin;
+
+            float x = (ox * radial - oy * strafe) * inverse;
+            float y = (oy * radial + ox * strafe) * inverse;
+            normalize(x, y, dx, dy);
+            mode = distanceSq > detectionSq ? SteeringMode::None : SteeringMode::Move;
+        }
+
+        static void circle(float px, float py, float tx, float ty, float detectionSq,
+                           float orbitRadius, float spin, float& dx, float& dy, SteeringMode& mode)
+        {
+            float ox = tx - px;
+            float oy = ty - py;
+            float distanceSq = ox * ox + oy * oy;
+            float distance = std::sqrt(distanceSq);
+            float inverse = distance > 0.f ? 1.f / distance : 0.f;
+
+            // Radial pull toward the orbit + constant tangent: spirals onto the orbit
+            float radial = std::clamp((distance - orbitRadius) / std::max(orbitRadius * 0.5f, 1.f), -1.f, 1.f);
+
+            float x = (ox * radial - oy * spin) * inverse;
+            float y = (oy * radial + ox * spin) * inverse;
+            normalize(x, y, dx, dy);
+            mode = distanceSq > detectionSq ? SteeringMode::None : SteeringMode::Move;
+        }
+
+        // Whole batches (one behaviour each)
+
+        static void chase(SteeringBatch& batch)
+        {
+            const size_t count = prepare(batch);
+            for (size_t i = 0; i < count; ++i)
+                chase(batch.posX[i], batch.posY[i], batch.targetX[i], batch.targetY[i], batch.detectionSq[i],
+                      batch.attackSq[i], batch.flowX[i], batch.flowY[i], batch.dirX[i], batch.dirY[i], batch.mode[i]);
+        }
+
+        static void flee(SteeringBatch& batch)
+        {
+            const size_t count = prepare(batch);
+            for (size_t i = 0; i < count; ++i)
+                flee(batch.posX[i], batch.posY[i], batch.targetX[i], batch.targetY[i], batch.detectionSq[i],
+                     batch.dirX[i], batch.dirY[i], batch.mode[i]);
+        }
+
+        static void ranged(SteeringBatch& batch)
+        {
+            const size_t count = prepare(batch);
+            for (size_t i = 0; i < count; ++i)
+                ranged(batch.posX[i], batch.posY[i], batch.targetX[i], batch.targetY[i], batch.detectionSq[i],
+                       batch.param[i], batch.spin[i], batch.dirX[i], batch.dirY[i], batch.mode[i]);
+        }
+
+        static void circle(SteeringBatch& batch)
+        {
+            const size_t count = prepare(batch);
+            for (size_t i = 0; i < count; ++i)
+                circle(batch.posX[i], batch.posY[i], batch.targetX[i], batch.targetY[i], batch.detectionSq[i],
+                       batch.param[i], batch.spin[i], batch.dirX[i], batch.dirY[i], batch.mode[i]);
+        }
+
+    private:
+        static void normalize(float x, float y, float& outX, float& outY)
+        {
+            float lengthSq = x * x + y * y;
+            float inverse = lengthSq > 0.f ? 1.f / std::sqrt(lengthSq) : 0.f;
+            outX = x * inverse;
+            outY = y * inverse;
+        }
+
+        // Size the output columns, returns the element count
+        static size_t prepare(SteeringBatch& batch)
+        {
+            const size_t count = batch.size();
+            batch.dirX.resize(count);
+            batch.dirY.resize(count);
+            batch.mode.resize(count);
+            return count;
+        }
+    };
+}
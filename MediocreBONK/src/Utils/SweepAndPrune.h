@@ -0,0 +1,137 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include "Broadphase.h"
+
+namespace MediocreBONK::Utils
+{
+    /*
+     * OPTIMIZATION TECHNIQUE: SWEEP AND PRUNE (Sort and Sweep)
+     *
+     * Idea:
+     * - Sort all boxes by their left edge (minX)
+     * - Walk the sorted list: box B can only overlap box A if B starts
+     *   before A ends (B.minX <= A.maxX)
+     * - As soon as a box starts after A ends, stop: nothing further right can touch A
+     *
+     * TEMPORAL COHERENCE:
+     * - Entities move only a few pixels per frame
+     * - Last frame's sorted order is still ALMOST sorted this frame
+     * - Insertion sort on an almost sorted list is ~O(n) (vs O(n log n) for std::sort)
+     * - We remember the order by entity and re-apply it before sorting
+     *
+     * Trade-offs:
+     * - Great for crowds that drift slowly (the horde around the player)
+     * - Degrades when many boxes share the same X range (a vertical wall of enemies)
+     * - Big teleports (respawns, culling) cost extra insertion sort shifts
+     */
+    class SweepAndPrune : public Broadphase
+    {
+    public:
+        const char* getName() const override { return "Sweep and Prune"; }
+
+    protected:
+        void onBuild() override
+        {
+            const auto& list = *proxies;
+
+            // Map entity -> this frame's proxy index
+            indexOfEntity.clear();
+            for (uint32_t i = 0; i < list.size(); ++i)
+            {
+                indexOfEntity[list[i].entity] = i;
+            }
+
+            // TEMPORAL COHERENCE: Re-apply last frame's order
+            // Entities that disappeared are skipped, new ones are appended
+            order.clear();
+            placed.assign(list.size(), false);
+            for (ECS::Entity* entity : previousOrder)
+            {
+                auto it = indexOfEntity.find(entity);
+                if (it != indexOfEntity.end() && !placed[it->second])
+                {
+                    order.push_back(it->second);
+                    placed[it->second] = true;
+                }
+            }
+            for (uint32_t i = 0; i < list.size(); ++i)
+            {
+                if (!placed[i])
+                    order.push_back(i);
+            }
+
+            // Insertion sort by minX (almost sorted -> close to linear)
+            for (size_t i = 1; i < order.size(); ++i)
+            {
+                uint32_t current = order[i];
+                float key = list[current].minX;
+                size_t j = i;
+                while (j > 0 && list[order[j - 1]].minX > key)
+                {
+                    order[j] = order[j - 1];
+                    --j;
+                }
+                order[j] = current;
+            }
+
+            // Remember order for next frame + widest box (bounds query search window)
+            previousOrder.clear();
+            maxWidth = 0.f;
+            sortedMinX.clear();
+            for (uint32_t index : order)
+            {
+                previousOrder.push_back(list[index].entity);
+                sortedMinX.push_back(list[index].minX);
+                maxWidth = std::max(maxWidth, list[index].maxX - list[index].minX);
+            }
+        }
+
+        void onFindPairs(std::vector<BroadphasePair>& pairs) override
+        {
+            const auto& list = *proxies;
+
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                const BroadphaseProxy& a = list[order[i]];
+
+                // Sweep right until boxes start after A ends
+                for (size_t j = i + 1; j < order.size() && sortedMinX[j] <= a.maxX; ++j)
+                {
+                    const BroadphaseProxy& b = list[order[j]];
+
+                    // X overlap is guaranteed by the sweep, only Y left to test
+                    if (a.minY <= b.maxY && a.maxY >= b.minY)
+                    {
+                        pairs.push_back({ std::min(order[i], order[j]), std::max(order[i], order[j]) });
+                    }
+                }
+            }
+        }
+
+        void onQuery(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& result) const override
+        {
+            const auto& list = *proxies;
+
+            // Any box overlapping the query starts no earlier than (query.minX - widest box)
+            auto first = std::lower_bound(sortedMinX.begin(), sortedMinX.end(), minX - maxWidth);
+
+            for (size_t i = first - sortedMinX.begin(); i < order.size() && sortedMinX[i] <= maxX; ++i)
+            {
+                if (list[order[i]].overlaps(minX, minY, maxX, maxY))
+                {
+                    result.push_back(order[i]);
+                }
+            }
+        }
+
+    private:
+        std::vector<uint32_t> order;           // Proxy indices sorted by minX
+        std::vector<float> sortedMinX;         // minX in sorted order (binary search for queries)
+        std::vector<ECS::Entity*> previousOrder; // Last frame's order (used as keys only, never dereferenced)
+        std::vector<bool> placed;
+        std::unordered_map<ECS::Entity*, uint32_t> indexOfEntity;
+        float maxWidth = 0.f;
+    };
+}
@@ -0,0 +1,242 @@
+#pragma once
+#include "Logger.h"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+namespace MediocreBONK::Utils
+{
+    /*
+     * DESIGN PATTERN: SINGLETON + THREAD POOL (Fork-Join)
+     *
+     * Problem:
+     * - The game loop is single threaded, the CPU usually has 4-16 cores
+     * - Creating std::thread every frame costs far more than the work itself
+     *
+     * Solution: Persistent worker threads + parallelFor
+     * - Workers are created once and sleep on a condition variable
+     * - parallelFor(count, grain, fn) splits [0, count) into chunks of 'grain'
+     * - Workers AND the calling thread grab chunks from an atomic counter
+     *   (automatic load balancing: fast threads take more chunks)
+     * - parallelFor returns when every chunk is done (fork-join)
+     *
+     * Worker index:
+     * - fn receives the index of the thread running the chunk:
+     *   0 = calling (main) thread, 1..N = pool workers
+     * - Lets callers keep one scratch buffer per worker (no locks, no sharing)
+     * - getWorkerIndex() returns the same value from anywhere on that thread
+     *
+     * Rules:
+     * - Chunks must only write data they own (or per-worker buffers)
+     * - Nested parallelFor (from inside a chunk) runs inline on that thread
+     * - Small jobs (a single chunk) run inline: no wake-up cost
+     */
+    class ThreadPool
+    {
+    public:
+        using RangeFunction = std::function<void(size_t begin, size_t end, size_t worker)>;
+
+        // SINGLETON PATTERN: Global access to the worker threads
+        static ThreadPool& getInstance()
+        {
+            static ThreadPool instance;
+            return instance;
+        }
+
+        // SINGLETON PATTERN: Prevent copying
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // Threads that can run chunks (workers + calling thread)
+        size_t getThreadCount() const { return workers.size() + 1; }
+
+        // 0 on the main thread, 1..N on pool workers
+        static size_t getWorkerIndex() { return currentWorkerIndex(); }
+
+        // Run fn over [0, count) in chunks of 'grain' items, blocks until done
+        void parallelFor(size_t count, size_t grain, const RangeFunction& fn)
+        {
+            if (count == 0)
+                return;
+
+            grain = std::max<size_t>(grain, 1);
+            size_t chunkCount = (count + grain - 1) / grain;
+
+            // Inline: no workers, single chunk, or nested call
+            if (workers.empty() || chunkCount <= 1 || insideJob())
+            {
+                fn(0, count, getWorkerIndex());
+                return;
+            }
+
+            {
+                // A worker that woke up late for the previous job may still be
+                // draining it; don't reset the chunk counter under its feet
+                std::unique_lock<std::mutex> lock(mutex);
+                done.wait(lock, [this] { return activeWorkers == 0; });
+
+                job.function = &fn;
+                job.count = count;
+                job.grain = grain;
+                job.chunkCount = chunkCount;
+                nextChunk.store(0);
+                pendingChunks = chunkCount;
+                ++generation;
+            }
+            wake.notify_all();
+
+            // Calling thread works too
+            insideJob() = true;
+            runChunks(job, 0);
+            insideJob() = false;
+
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [this] { return pendingChunks == 0 && activeWorkers == 0; });
+        }
+
+        // DETERMINISTIC PARALLEL OUTPUT:
+        // fn(begin, end, worker, output) appends results for items [begin, end) to 'output'
+        // - Every chunk writes its own buffer (no locks, no shared push_back)
+        // - Buffers are appended to 'merged' in chunk order afterwards
+        // - 'merged' is identical to a serial loop over [0, count),
+        //   whatever the thread count or scheduling
+        template<typename T, typename Function>
+        void parallelCollect(size_t count, size_t grain, std::vector<std::vector<T>>& chunkBuffers,
+                             std::vector<T>& merged, Function fn)
+        {
+            grain = std::max<size_t>(grain, 1);
+            size_t chunkCount = (count + grain - 1) / grain;
+            if (chunkBuffers.size() < chunkCount)
+                chunkBuffers.resize(chunkCount);
+            for (size_t c = 0; c < chunkCount; ++c)
+                chunkBuffers[c].clear();
+
+            // Ranges are chunk aligned (or the whole range when run inline)
+            parallelFor(count, grain, [&](size_t begin, size_t end, size_t worker) {
+                fn(begin, end, worker, chunkBuffers[begin / grain]);
+            });
+
+            for (size_t c = 0; c < chunkCount; ++c)
+                merged.insert(merged.end(), chunkBuffers[c].begin(), chunkBuffers[c].end());
+        }
+
+    private:
+        struct Job
+        {
+            const RangeFunction* function = nullptr;
+            size_t count = 0;
+            size_t grain = 1;
+            size_t chunkCount = 0;
+        };
+
+        ThreadPool()
+            : generation(0)
+            , pendingChunks(0)
+            , activeWorkers(0)
+            , stopping(false)
+        {
+            unsigned int hardware = std::thread::hardware_concurrency();
+            size_t workerCount = hardware > 1 ? std::min<size_t>(hardware - 1, 7) : 0;
+
+            for (size_t i = 0; i < workerCount; ++i)
+            {
+                workers.emplace_back([this, i] { workerLoop(i + 1); });
+            }
+
+            Logger::info("ThreadPool initialized with " + std::to_string(workerCount) + " worker threads");
+        }
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+
+            for (auto& worker : workers)
+            {
+                if (worker.joinable())
+                    worker.join();
+            }
+        }
+
+        static size_t& currentWorkerIndex()
+        {
+            thread_local size_t index = 0;
+            return index;
+        }
+
+        static bool& insideJob()
+        {
+            thread_local bool inside = false;
+            return inside;
+        }
+
+        void workerLoop(size_t index)
+        {
+            currentWorkerIndex() = index;
+            insideJob() = true; // Workers never fork again
+            uint64_t seenGeneration = 0;
+
+            while (true)
+            {
+                Job localJob;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+                    if (stopping)
+                        return;
+
+                    // Copy job under the lock (caller may post the next one right after)
+                    seenGeneration = generation;
+                    localJob = job;
+                    ++activeWorkers;
+                }
+
+                runChunks(localJob, index);
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    --activeWorkers;
+                }
+                done.notify_all();
+            }
+        }
+
+        void runChunks(const Job& current, size_t worker)
+        {
+            while (true)
+            {
+                size_t chunk = nextChunk.fetch_add(1);
+                if (chunk >= current.chunkCount)
+                    break;
+
+                size_t begin = chunk * current.grain;
+                size_t end = std::min(current.count, begin + current.grain);
+                (*current.function)(begin, end, worker);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                --pendingChunks;
+            }
+        }
+
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+
+        Job job;
+        std::atomic<size_t> nextChunk{ 0 };
+        uint64_t generation;
+        size_t pendingChunks;
+        size_t activeWorkers;
+        bool stopping;
+    };
+}
@@ -0,0 +1,262 @@
+#pragma once
+#include <SFML/System/Time.hpp>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+
+namespace MediocreBONK::Utils
+{
+    // Identifies one scheduled timer (generation rejects handles of recycled timers)
+    struct TimerHandle
+    {
+        uint32_t index = 0;
+        uint32_t generation = 0; // 0 = null handle
+
+        bool isValid() const { return generation != 0; }
+        bool operator==(const TimerHandle& other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const TimerHandle& other) const { return !(*this == other); }
+    };
+
+    // One timer that fired during advance()
+    struct TimerExpiry
+    {
+        TimerHandle handle;
+        uint64_t userData; // Whatever the owner scheduled it with (e.g. an entity ID)
+    };
+
+    /*
+     * OPTIMIZATION TECHNIQUE: HIERARCHICAL TIMER WHEEL
+     *
+     * Problem:
+     * - "float lifetime; lifetime -= dt; if (lifetime <= 0) ..." in every
+     *   component: per-frame cost = number of LIVE timers, although almost
+     *   none of them expire in a given frame (an XP gem lives 40s = 2400 ticks)
+     *
+     * Solution: Timers sorted into buckets by deadline (like a clock)
+     * - Time is counted in fixed ticks (default 1/60s, the update rate)
+     * - Levels x 64 slots: level 0 slot = one tick, level 1 slot = 64 ticks,
+     *   level 2 slot = 4096 ticks... (4 levels = 16.7M ticks, ~77h at 60Hz)
+     * - schedule(): O(1), the timer goes into the slot of its deadline at the
+     *   coarsest level that can still tell it apart
+     * - Each tick: the level 0 slot of that tick expires as a whole; every 64
+     *   ticks one slot of the level above is re-distributed downwards (cascade)
+     * - cancel(): O(1) unlink (slots are intrusive doubly-linked lists)
+     * - Timer nodes live in one vector + free list (no allocation per timer)
+     *
+     * Per-tick cost: timers that expire + (amortized) timers that cascade.
+     * Live timers that are nowhere near their deadline cost nothing.
+     *
+     * Usage:
+     *   Utils::TimerWheel wheel;
+     *   auto handle = wheel.schedule(40.f, entity->getId());
+     *   for (const auto& expiry : wheel.advance(dt)) { ... expiry.userData ... }
+     */
+    class TimerWheel
+    {
+    public:
+        static constexpr uint32_t SlotBits = 6;
+        static constexpr uint32_t SlotCount = 1u << SlotBits;
+        static constexpr uint32_t SlotMask = SlotCount - 1;
+        static constexpr uint32_t Levels = 4;
+        static constexpr uint64_t MaxTicks = (1ull << (SlotBits * Levels)) - 1;
+
+        explicit TimerWheel(float tickSeconds = 1.f / 60.f)
+            : tickSeconds(tickSeconds)
+            , accumulator(0.f)
+            , currentTick(0)
+            , pending(0)
+        {
+            slots.fill(Null);
+        }
+
+        // Fires after 'seconds' (rounded up to whole ticks, at least one tick)
+        TimerHandle schedule(float seconds, uint64_t userData)
+        {
+            uint64_t ticks = static_cast<uint64_t>(std::ceil(std::max(seconds, 0.f) / tickSeconds));
+            ticks = std::clamp<uint64_t>(ticks, 1, MaxTicks);
+
+            uint32_t index = allocateNode();
+            Node& node = nodes[index];
+            node.deadline = currentTick + ticks;
+            node.userData = userData;
+            link(index);
+            ++pending;
+            return { index, node.generation };
+        }
+
+        // No effect on handles that already fired or were cancelled
+        bool cancel(TimerHandle handle)
+        {
+            if (!isPending(handle))
+                return false;
+
+            unlink(handle.index);
+            freeNode(handle.index);
+            --pending;
+            return true;
+        }
+
+        bool isPending(TimerHandle handle) const
+        {
+            return handle.isValid() && handle.index < nodes.size() &&
+                   nodes[handle.index].generation == handle.generation && nodes[handle.index].slot != Null;
+        }
+
+        // Seconds until the timer fires (0 if not pending)
+        float getRemaining(TimerHandle handle) const
+        {
+            if (!isPending(handle))
+                return 0.f;
+            return (nodes[handle.index].deadline - currentTick) * tickSeconds - accumulator;
+        }
+
+        // Move time forward; returns every timer that fired, in tick order
+        // (the list is reused: valid until the next advance())
+        const std::vector<TimerExpiry>& advance(sf::Time dt)
+        {
+            expired.clear();
+            accumulator += dt.asSeconds();
+            while (accumulator >= tickSeconds)
+            {
+                accumulator -= tickSeconds;
+                tick();
+            }
+            return expired;
+        }
+
+        size_t getPendingCount() const { return pending; }
+
+        // Drops every pending timer (their handles become stale)
+        void clear()
+        {
+            for (uint32_t index = 0; index < nodes.size(); ++index)
+            {
+                if (nodes[index].slot != Null)
+                    freeNode(index);
+            }
+            expired.clear();
+            slots.fill(Null);
+            accumulator = 0.f;
+            pending = 0;
+        }
+
+    private:
+        static constexpr uint32_t Null = 0xFFFFFFFFu;
+
+        struct Node
+        {
+            uint64_t deadline = 0;   // Tick
+            uint64_t userData = 0;
+            uint32_t prev = Null;
+            uint32_t next = Null;
+            uint32_t slot = Null;    // Flat slot index (level * SlotCount + slot), Null = not scheduled
+            uint32_t generation = 1;
+        };
+
+        void tick()
+        {
+            ++currentTick;
+
+            // Cascade: highest level whose boundary was crossed first, so its
+            // timers can land in the lower slots cascaded right after
+            uint32_t top = 0;
+            while (top + 1 < Levels && (currentTick & ((1ull << (SlotBits * (top + 1))) - 1)) == 0)
+                ++top;
+            for (uint32_t level = top; level >= 1; --level)
+                cascade(level);
+
+            // Everything in this tick's level 0 slot is due now
+            uint32_t slot = static_cast<uint32_t>(currentTick & SlotMask);
+            uint32_t index = slots[slot];
+            slots[slot] = Null;
+            while (index != Null)
+            {
+                uint32_t next = nodes[index].next;
+                TimerHandle handle{ index, nodes[index].generation };
+                expired.push_back({ handle, nodes[index].userData });
+                freeNode(index);
+                --pending;
+                index = next;
+            }
+        }
+
+        void cascade(uint32_t level)
+        {
+            uint32_t flat = level * SlotCount + static_cast<uint32_t>((currentTick >> (SlotBits * level)) & SlotMask);
+            uint32_t index = slots[flat];
+            slots[flat] = Null;
+            while (index != Null)
+            {
+                uint32_t next = nodes[index].next;
+                link(index); // Re-sorted relative to the current tick: lands lower
+                index = next;
+            }
+        }
+
+        // Insert at the coarsest level that still separates it from 'now'
+        void link(uint32_t index)
+        {
+            Node& node = nodes[index];
+            uint64_t delta = node.deadline - currentTick;
+            uint32_t level = 0;
+            while (level + 1 < Levels && delta >= (1ull << (SlotBits * (level + 1))))
+                ++level;
+
+            uint32_t flat = level * SlotCount + static_cast<uint32_t>((node.deadline >> (SlotBits * level)) & SlotMask);
+            node.slot = flat;
+            node.prev = Null;
+            node.next = slots[flat];
+            if (node.next != Null)
+                nodes[node.next].prev = index;
+            slots[flat] = index;
+        }
+
+        void unlink(uint32_t index)
+        {
+            Node& node = nodes[index];
+            if (node.prev != Null)
+                nodes[node.prev].next = node.next;
+            else
+                slots[node.slot] = node.next;
+            if (node.next != Null)
+                nodes[node.next].prev = node.prev;
+            node.slot = Null;
+        }
+
+        uint32_t allocateNode()
+        {
+            if (!freeNodes.empty())
+            {
+                uint32_t index = freeNodes.back();
+                freeNodes.pop_back();
+                return index;
+            }
+            nodes.emplace_back();
+            return static_cast<uint32_t>(nodes.size() - 1);
+        }
+
+        void freeNode(uint32_t index)
+        {
+            Node& node = nodes[index];
+            node.slot = Null;
+            node.prev = Null;
+            node.next = Null;
+            // Outstanding handles to this node become stale (0 stays reserved for null)
+            if (++node.generation == 0)
+                node.generation = 1;
+            freeNodes.push_back(index);
+        }
+
+        float tickSeconds;
+        float accumulator;     // Time not yet turned into a tick
+        uint64_t currentTick;
+        size_t pending;
+
+        std::array<uint32_t, Levels * SlotCount> slots; // Head node of each slot
+        std::vector<Node> nodes;
+        std::vector<uint32_t> freeNodes;
+        std::vector<TimerExpiry> expired;               // Last advance()
+    };
+}